@@ -0,0 +1,160 @@
+// Include standard headers
+#include <algorithm>
+
+#include "Archipelago.hpp"
+#include "ThreadPool.hpp"
+
+/************************************************************/
+Archipelago::Archipelago(const Rocket &f_rocket,
+                         const LevelGeometry &f_geometry,
+                         const DistanceField *f_field,
+                         const std::uint64_t f_seed,
+                         const GeneticConfig &f_config, const bool f_swept,
+                         const bool f_shared)
+    : island{-1}, generation{0}, gene{-1}, fuel{0}, nb_migrations{0},
+      config{f_config}, floor_index(f_geometry),
+      mailboxes{new Mailbox[f_config.nb_islands * f_config.nb_islands]},
+      landed{false}, lockstep{f_config.deterministic},
+      solution(f_config.chromosome_size) {
+  // Independent streams of the islands, from a single seed
+  Random seeds(f_seed);
+  for (int i = 0; i < config.nb_islands; ++i) {
+    islands.emplace_back(new GeneticPopulation(f_rocket, f_geometry, f_field,
+                                               seeds.next(), config));
+    evaluators.emplace_back(new Evaluator(floor_index, 1, f_swept, f_shared));
+    rngs.push_back(seeds.split());
+  }
+  for (int k = 0; k < config.nb_islands * config.nb_islands; ++k)
+    mailboxes[k].genes.resize(config.migration_size * config.chromosome_size);
+}
+
+/************************************************************/
+bool Archipelago::run(const int f_max_generations, const bool f_lockstep) {
+  lockstep = config.deterministic || f_lockstep;
+  if (!lockstep) {
+    ThreadPool pool(config.nb_islands);
+    pool.run(config.nb_islands, [&](const int f_island, const int) {
+      evolve(f_island, 1, f_max_generations);
+    });
+    return landed;
+  }
+
+  // Lockstep: the islands evolve up to the next migration, on any worker,
+  // then migrate one after the other
+  ThreadPool pool(config.nb_threads);
+  for (int first = 1;
+       !landed && (f_max_generations == 0 || first <= f_max_generations);
+       first += config.migration_interval) {
+    int last{first + config.migration_interval - 1};
+    if (f_max_generations > 0)
+      last = std::min(last, f_max_generations);
+    pool.run(config.nb_islands, [&](const int f_island, const int) {
+      evolve(f_island, first, last);
+    });
+
+    landed = island != -1;
+    if (!landed && config.nb_islands > 1 &&
+        last % config.migration_interval == 0) {
+      for (int i = 0; i < config.nb_islands; ++i)
+        emigrate(i);
+      for (int i = 0; i < config.nb_islands; ++i)
+        immigrate(i);
+    }
+  }
+  return landed;
+}
+
+/************************************************************/
+const Chromosome *Archipelago::getSolution() const {
+  return island == -1 ? nullptr : &solution;
+}
+
+/************************************************************/
+void Archipelago::evolve(const int f_island, const int f_first,
+                         const int f_last) {
+  GeneticPopulation &population{*islands[f_island]};
+  Evaluator &evaluator{*evaluators[f_island]};
+
+  for (int gen = f_first; !landed && (f_last == 0 || gen <= f_last); ++gen) {
+    const Landing landing{evaluator.evaluate(population, 0)};
+    if (landing.chromosome != -1)
+      claim(f_island, gen, landing.chromosome, landing.gene, landing.fuel);
+    if (landed || landing.chromosome != -1)
+      return;
+
+    population.mutate(0);
+    if (!lockstep && config.nb_islands > 1 &&
+        gen % config.migration_interval == 0) {
+      emigrate(f_island);
+      immigrate(f_island);
+    }
+  }
+}
+
+/************************************************************/
+void Archipelago::claim(const int f_island, const int f_generation,
+                        const int f_chrom, const int f_gene,
+                        const int f_fuel) {
+  // The first island to land stops the others. In deterministic mode, the
+  // landing of the first generation wins, then the one of the first island
+  std::lock_guard<std::mutex> lock(claim_mutex);
+  const bool first{island == -1 ||
+                   (config.deterministic &&
+                    (f_generation < generation ||
+                     (f_generation == generation && f_island < island)))};
+  if (!first)
+    return;
+
+  island = f_island;
+  generation = f_generation;
+  gene = f_gene;
+  fuel = f_fuel;
+  solution = *islands[f_island]->getChromosome(f_chrom);
+  if (!config.deterministic)
+    landed = true;
+}
+
+/************************************************************/
+void Archipelago::emigrate(const int f_island) {
+  int to{(f_island + 1) % config.nb_islands};
+  if (config.migration_topology == Topology::Random) {
+    to = rngs[f_island].bounded(config.nb_islands - 1);
+    to += to >= f_island;
+  }
+
+  // The previous migrants are not received yet: the new ones are dropped
+  Mailbox &box{mailbox(f_island, to)};
+  if (box.full)
+    return;
+  for (int i = 0; i < config.migration_size; ++i) {
+    const Chromosome *migrant{islands[f_island]->getRanked(i)};
+    packGenes(migrant->chromosome.data(),
+              &box.genes[i * config.chromosome_size], config.chromosome_size);
+  }
+  box.full = true;
+}
+
+/************************************************************/
+void Archipelago::immigrate(const int f_island) {
+  GeneticPopulation &population{*islands[f_island]};
+
+  // From the last child backward, sparing the elites
+  int slot{config.population_size};
+  for (int from = 0; from < config.nb_islands; ++from) {
+    Mailbox &box{mailbox(from, f_island)};
+    if (from == f_island || !box.full)
+      continue;
+
+    for (int i = 0; i < config.migration_size && slot > config.elitismIdx();
+         ++i) {
+      population.setGenes(--slot, &box.genes[i * config.chromosome_size]);
+    }
+    box.full = false;
+    ++nb_migrations;
+  }
+}
+
+/************************************************************/
+Archipelago::Mailbox &Archipelago::mailbox(const int f_from, const int f_to) {
+  return mailboxes[f_to * config.nb_islands + f_from];
+}
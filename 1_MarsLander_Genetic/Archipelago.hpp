@@ -0,0 +1,129 @@
+#ifndef ARCHIPELAGO_HPP
+#define ARCHIPELAGO_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "DistanceField.hpp"
+#include "Evaluator.hpp"
+#include "FloorIndex.hpp"
+#include "Genetic.hpp"
+#include "LevelGeometry.hpp"
+#include "Random.hpp"
+#include "Rocket.hpp"
+
+//! @brief  Island model of the genetic algorithm.
+//!
+//! `nb_islands` populations evolve apart, each on its own thread, flying the
+//! chromosomes with its own `Evaluator`, in the modes of `solve`. Every
+//! `migration_interval` generations, an island sends its `migration_size`
+//! fittest chromosomes to the next island, or to a random one, and the migrants
+//! it received replace its last children. The migrants travel packed, a byte
+//! per gene. Whatever the timing of the threads, a migration never blocks: a
+//! mailbox still full drops the new migrants. The first landing stops every
+//! island.
+//!
+//! In deterministic mode, the islands run in lockstep instead: all of them
+//! evolve up to the next migration, on the workers of the pool, then migrate
+//! one after the other. The landing of the first generation, then of the
+//! first island, wins: the same seed gives the same solution, whatever the
+//! threads. `run` may ask for the lockstep in any mode too: with a single
+//! thread, the islands then share the thread of the caller.
+class Archipelago {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_rocket    Initial rocket.
+  //! @param[in] f_geometry  Geometry of the level.
+  //! @param[in] f_field     Geodesic distance field of the level, nullptr
+  //!                        for the distance along the floor.
+  //! @param[in] f_seed      Seed of the islands.
+  //! @param[in] f_config    Dimensions, rates and islands.
+  //! @param[in] f_swept     Swept collisions, see `Evaluator`.
+  //! @param[in] f_shared    Shared prefixes, see `Evaluator`.
+  Archipelago(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+              const DistanceField *f_field, const std::uint64_t f_seed,
+              const GeneticConfig &f_config, const bool f_swept,
+              const bool f_shared);
+
+  //! @brief  Evolve every island on its own thread, or in lockstep on the
+  //!         pool of `nb_threads` workers, until a landing.
+  //!
+  //! @param[in] f_max_generations  Generations per island at most, 0 for no
+  //!                               limit.
+  //! @param[in] f_lockstep         Lockstep even without the deterministic
+  //!                               mode.
+  //!
+  //! @return True if an island landed, else false.
+  bool run(const int f_max_generations = 0, const bool f_lockstep = false);
+
+  //! @brief  Get the chromosome which landed.
+  //!
+  //! @return A pointer to the chromosome, nullptr if none.
+  const Chromosome *getSolution() const;
+
+  int island;     //!< Island which landed, -1 if none.
+  int generation; //!< Its generation of the landing.
+  int gene;       //!< Index of the gene of the touchdown.
+  int fuel;       //!< Fuel left.
+
+  std::atomic<long long> nb_migrations; //!< Batches of migrants received.
+
+  const GeneticConfig config; //!< Dimensions, rates and islands.
+
+private:
+  //! @brief  Migrants on their way from an island to another. The sender
+  //!         fills it when empty, the receiver empties it when full.
+  struct Mailbox {
+    std::atomic<bool> full{false}; //!< Migrants waiting for the receiver.
+    std::vector<PackedGene> genes; //!< Genes of the migrants, packed, one
+                                   //!< after the other.
+  };
+
+  //! @brief  Evolve an island, until a landing of any of them.
+  //!
+  //! @param[in] f_island  Index of the island.
+  //! @param[in] f_first   Index of the first generation, from 1.
+  //! @param[in] f_last    Index of the last generation, 0 for no limit.
+  void evolve(const int f_island, const int f_first, const int f_last);
+
+  //! @brief  Keep the landing of an island, if it wins.
+  //!
+  //! @param[in] f_island      Index of the island.
+  //! @param[in] f_generation  Its generation.
+  //! @param[in] f_chrom       Index of the chromosome which landed.
+  //! @param[in] f_gene        Index of the gene of the touchdown.
+  //! @param[in] f_fuel        Fuel left.
+  void claim(const int f_island, const int f_generation, const int f_chrom,
+             const int f_gene, const int f_fuel);
+
+  //! @brief  Send the fittest chromosomes of an island, just mutated.
+  //!
+  //! @param[in] f_island  Index of the island.
+  void emigrate(const int f_island);
+
+  //! @brief  Replace the last children of an island, just mutated, by the
+  //!         migrants waiting for it.
+  //!
+  //! @param[in] f_island  Index of the island.
+  void immigrate(const int f_island);
+
+  //! @brief  Get the mailbox from an island to another.
+  Mailbox &mailbox(const int f_from, const int f_to);
+
+  const FloorIndex floor_index; //!< The floor of the level.
+
+  std::vector<std::unique_ptr<GeneticPopulation>> islands; //!< Populations.
+  std::vector<std::unique_ptr<Evaluator>> evaluators; //!< One per island.
+  std::vector<Random> rngs;             //!< Destinations of the migrants.
+  std::unique_ptr<Mailbox[]> mailboxes; //!< From every island to every one.
+
+  std::atomic<bool> landed; //!< An island landed.
+  bool lockstep;            //!< The islands migrate between the steps.
+  std::mutex claim_mutex;   //!< Landings claimed one at a time.
+  Chromosome solution;      //!< The chromosome which landed.
+};
+
+#endif
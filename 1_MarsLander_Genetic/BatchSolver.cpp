@@ -0,0 +1,117 @@
+// Include standard headers
+#include <chrono>
+
+#include "Archipelago.hpp"
+#include "BatchSolver.hpp"
+#include "Evaluator.hpp"
+#include "ThreadPool.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+/************************************************************/
+BatchSolver::Level::Level(const Levels &f_levels, const int f_level,
+                          const bool f_geodesic)
+    : rocket{f_levels.getRocket(f_level)},
+      geometry(f_levels.getFloor(f_level).data(),
+               static_cast<int>(f_levels.getSizeFloor(f_level))),
+      floor_index(geometry),
+      field{f_geodesic ? new DistanceField(geometry) : nullptr} {}
+
+/************************************************************/
+BatchSolver::BatchSolver(const GeneticConfig &f_config, const double f_timer,
+                         const bool f_geodesic, const bool f_swept,
+                         const bool f_shared, const int f_max_generations)
+    : nb_done{0}, nb_solved{0}, config{f_config}, timer{f_timer},
+      geodesic{f_geodesic}, swept{f_swept}, shared{f_shared},
+      max_generations{f_max_generations} {}
+
+/************************************************************/
+void BatchSolver::run(const std::vector<Job> &f_jobs,
+                      std::vector<JobResult> &f_results) {
+  // Every level of the jobs, built once
+  const Levels all_levels;
+  for (const Job &job : f_jobs) {
+    if (!levels[job.level - 1])
+      levels[job.level - 1].reset(new Level(all_levels, job.level, geodesic));
+  }
+
+  f_results.assign(f_jobs.size(), JobResult());
+  ThreadPool pool(config.nb_threads);
+  pool.run(static_cast<int>(f_jobs.size()),
+           [&](const int f_job, const int) {
+             f_results[f_job] = solve(f_jobs[f_job]);
+             nb_solved += f_results[f_job].solved;
+             ++nb_done;
+           });
+}
+
+/************************************************************/
+JobResult BatchSolver::solve(const Job &f_job) const {
+  const Level &level{*levels[f_job.level - 1]};
+  const FloorIndex &floor_index{level.floor_index};
+
+  JobResult result;
+  const std::chrono::high_resolution_clock::time_point start{
+      std::chrono::high_resolution_clock::now()};
+  if (config.nb_islands > 1) {
+    // The islands of the job, as `solve`: without the incremental search,
+    // and in lockstep on the thread of the job, whatever the mode. The jobs
+    // already keep every core busy
+    GeneticConfig island_config{config};
+    island_config.nb_threads = 1;
+    Archipelago archipelago(level.rocket, level.geometry, level.field.get(),
+                            f_job.seed, island_config, swept, shared);
+    result.solved = archipelago.run(max_generations, true);
+    result.fuel = archipelago.fuel;
+    result.generations =
+        result.solved ? archipelago.generation : max_generations;
+
+    const std::chrono::duration<double> elapsed_seconds{
+        std::chrono::high_resolution_clock::now() - start};
+    result.elapsedSec = elapsed_seconds.count();
+    return result;
+  }
+
+  GeneticPopulation population(level.rocket, level.geometry,
+                               level.field.get(), f_job.seed, config);
+  Evaluator evaluator(floor_index, 1, swept, shared);
+  std::chrono::high_resolution_clock::time_point start_loop{start};
+  int idxStart{0};
+  int prevGeneration{0};
+  bool isAlive{true};
+  while (isAlive && !result.solved &&
+         (max_generations == 0 || result.generations < max_generations)) {
+    // Incremental search: the best gene so far is played, as `solve` does
+    const std::chrono::duration<double> elapsed_seconds{
+        std::chrono::high_resolution_clock::now() - start_loop};
+    if (config.isGeneDue(timer, result.generations - prevGeneration,
+                         elapsed_seconds.count())) {
+      const Gene *bestGen{population.getRanked(0)->getGene(idxStart)};
+      Rocket &rocket{population.rocket_save};
+      rocket.updateRocket(bestGen->angle, bestGen->thrust);
+      isAlive = rocket.x >= 0 && rocket.x <= _w && rocket.y >= 0 &&
+                rocket.y <= _h &&
+                floor_index.firstIntersection(
+                    {{rocket.pX, rocket.pY}, {rocket.x, rocket.y}}) == -1;
+      population.advance(idxStart);
+      idxStart++;
+      prevGeneration = result.generations;
+      start_loop = std::chrono::high_resolution_clock::now();
+    }
+    result.generations++;
+    if (!isAlive)
+      break;
+
+    const Landing landing{evaluator.evaluate(population, idxStart)};
+    result.solved = landing.chromosome != -1;
+    result.fuel = landing.fuel;
+    if (!result.solved)
+      population.mutate(idxStart);
+  }
+
+  const std::chrono::duration<double> elapsed_seconds{
+      std::chrono::high_resolution_clock::now() - start};
+  result.elapsedSec = elapsed_seconds.count();
+  return result;
+}
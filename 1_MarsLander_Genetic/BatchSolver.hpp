@@ -0,0 +1,104 @@
+#ifndef BATCH_SOLVER_HPP
+#define BATCH_SOLVER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "DistanceField.hpp"
+#include "FloorIndex.hpp"
+#include "Genetic.hpp"
+#include "LevelGeometry.hpp"
+#include "Rocket.hpp"
+#include "levels.hpp"
+
+//! @brief  A level to solve, with the seed of its population.
+struct Job {
+  int level;          //!< The level, from 1 to 7.
+  std::uint64_t seed; //!< Seed of the population.
+};
+
+//! @brief  Outcome of a job.
+struct JobResult {
+  bool solved{false};    //!< Landed or not.
+  int fuel{0};           //!< Fuel left, 0 if not solved.
+  double elapsedSec{0.}; //!< Time of the search.
+  int generations{0};    //!< Generations of the search.
+};
+
+//! @brief  Solve many jobs at once, one per thread of a pool, without the
+//!         display.
+//!
+//! A job runs the search of `solve`, its generations flown by an `Evaluator`
+//! on the thread of the job: the evaluation cache, the swept and shared
+//! modes, and the incremental search of the timer. With several islands, a
+//! job runs an `Archipelago` instead, as `solve` does, its islands in
+//! lockstep on the thread of the job.
+//!
+//! The levels are built once: their geometry, floor index and distance field,
+//! built only if geodesic, are read by every job of the level. A job writes
+//! its own result only, then counts itself done with atomics: the results
+//! need no lock.
+class BatchSolver {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_config           Dimensions and rates of the populations,
+  //!                               and threads of the pool.
+  //! @param[in] f_timer            Timer of the incremental search, in s. 0
+  //!                               to disable it.
+  //! @param[in] f_geodesic         Score the crashes with the geodesic
+  //!                               distance.
+  //! @param[in] f_swept            Swept collisions, see `Evaluator`.
+  //! @param[in] f_shared           Shared prefixes, see `Evaluator`.
+  //! @param[in] f_max_generations  Generations per job at most, 0 for no
+  //!                               limit.
+  BatchSolver(const GeneticConfig &f_config, const double f_timer,
+              const bool f_geodesic, const bool f_swept, const bool f_shared,
+              const int f_max_generations = 0);
+
+  //! @brief  Solve the jobs, as many at once as the pool has workers.
+  //!
+  //! @param[in]  f_jobs     The jobs.
+  //! @param[out] f_results  Their outcomes, in the same order.
+  void run(const std::vector<Job> &f_jobs, std::vector<JobResult> &f_results);
+
+  std::atomic<int> nb_done;   //!< Jobs done, since the c'tor.
+  std::atomic<int> nb_solved; //!< Jobs solved among them.
+
+private:
+  //! @brief  Level data shared by its jobs.
+  struct Level {
+    //! @brief  C'tor. Builds the level.
+    //!
+    //! @param[in] f_levels    The levels.
+    //! @param[in] f_level     The level, from 1 to 7.
+    //! @param[in] f_geodesic  Build the geodesic distance field.
+    Level(const Levels &f_levels, const int f_level, const bool f_geodesic);
+
+    Rocket rocket;          //!< Initial rocket.
+    LevelGeometry geometry; //!< Geometry of the level.
+    FloorIndex floor_index; //!< Floor index, shared by the jobs.
+    std::unique_ptr<const DistanceField> field; //!< Geodesic distance field,
+                                                //!< nullptr if not geodesic.
+  };
+
+  //! @brief  Run the search of a job.
+  //!
+  //! @param[in] f_job  The job.
+  //!
+  //! @return Its outcome.
+  JobResult solve(const Job &f_job) const;
+
+  const GeneticConfig config; //!< Dimensions and rates.
+  const double timer;         //!< Timer of the incremental search, in s.
+  const bool geodesic;        //!< Geodesic distance of the crashes.
+  const bool swept;           //!< Swept collisions.
+  const bool shared;          //!< Shared prefixes.
+  const int max_generations;  //!< Generations per job at most, 0 for all.
+
+  std::unique_ptr<Level> levels[7]; //!< Levels built so far.
+};
+
+#endif
@@ -0,0 +1,1652 @@
+// Include standard headers
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "Archipelago.hpp"
+#include "BatchSolver.hpp"
+#include "Benchmark.hpp"
+#include "DistanceField.hpp"
+#include "Evaluator.hpp"
+#include "FloorIndex.hpp"
+#include "FloorSegments.hpp"
+#include "Genetic.hpp"
+#include "LevelGeometry.hpp"
+#include "Random.hpp"
+#include "Rocket.hpp"
+#include "RocketBatch.hpp"
+#include "Selection.hpp"
+#include "ThreadPool.hpp"
+#include "Trajectory.hpp"
+#include "Utils.hpp"
+#include "levels.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+//! @brief  Time a function.
+//!
+//! @param[in] f  The function to time.
+//!
+//! @return The elapsed time, in seconds.
+template <class F> double timeIt(F f) {
+  const std::chrono::high_resolution_clock::time_point start{
+      std::chrono::high_resolution_clock::now()};
+  f();
+  const std::chrono::duration<double> elapsed{
+      std::chrono::high_resolution_clock::now() - start};
+  return elapsed.count();
+}
+
+/************************************************************/
+void runBenchmarks() {
+  benchmarkPhysics();
+  benchmarkPrecision();
+  benchmarkCollision();
+  benchmarkSegmentKernel();
+  benchmarkSweptCollision();
+  benchmarkDistanceField();
+  benchmarkSelection();
+  benchmarkRandom();
+  benchmarkCrossover();
+  benchmarkGeneMatrix();
+  benchmarkPackedGenes();
+  benchmarkConfig();
+  benchmarkRanking();
+  benchmarkEvaluationCache();
+  benchmarkPrefixTree();
+  benchmarkThreads();
+  benchmarkIslands();
+  benchmarkDeterminism();
+  benchmarkRollingHorizon();
+}
+
+//! @brief  Time `_POPULATION_SIZE` scalar rockets flying a whole chromosome.
+//!
+//! @param[in] f_rocket  The initial rocket.
+//! @param[in] f_angles, f_thrusts  The requests of every rocket at every step.
+//! @param[in] f_loops   Number of repetitions.
+//! @param[out] f_check  Sum of the final X coordinates, so that nothing is skipped.
+//!
+//! @return The time per step, in ns.
+template <class Physics>
+double timeScalar(const Rocket &f_rocket, const std::int8_t *f_angles,
+                  const std::int8_t *f_thrusts, const int f_loops,
+                  double &f_check) {
+  const double sec{timeIt([&]() {
+    for (int loop = 0; loop < f_loops; ++loop) {
+      for (int chrom = 0; chrom < _POPULATION_SIZE; ++chrom) {
+        Rocket rocket{f_rocket};
+        for (int gen = 0; gen < _CHROMOSOME_SIZE; ++gen) {
+          rocket.updateRocket<Physics>(
+              f_angles[gen * _BATCH_SIZE + chrom],
+              f_thrusts[gen * _BATCH_SIZE + chrom]);
+        }
+        f_check += rocket.x;
+      }
+    }
+  })};
+  return 1e9 * sec / (static_cast<double>(f_loops) * _POPULATION_SIZE *
+                      _CHROMOSOME_SIZE);
+}
+
+//! @brief  Same as `timeScalar`, with a RocketBatch.
+template <class Physics>
+double timeBatch(const Rocket &f_rocket, const std::int8_t *f_angles,
+                 const std::int8_t *f_thrusts, const int f_loops,
+                 double &f_check) {
+  RocketBatch rockets;
+  const double sec{timeIt([&]() {
+    for (int loop = 0; loop < f_loops; ++loop) {
+      rockets.init(f_rocket);
+      for (int gen = 0; gen < _CHROMOSOME_SIZE; ++gen) {
+        rockets.updateRockets<Physics>(&f_angles[gen * _BATCH_SIZE],
+                                       &f_thrusts[gen * _BATCH_SIZE]);
+      }
+      f_check += rockets.x[0];
+    }
+  })};
+  return 1e9 * sec / (static_cast<double>(f_loops) * _POPULATION_SIZE *
+                      _CHROMOSOME_SIZE);
+}
+
+/************************************************************/
+void benchmarkPhysics() {
+  constexpr int loops{200};
+
+  const Levels levels;
+  const Rocket rocket{levels.getRocket(1)};
+
+  // Same random requests for every simulator
+  static std::int8_t angles[_CHROMOSOME_SIZE * _BATCH_SIZE];
+  static std::int8_t thrusts[_CHROMOSOME_SIZE * _BATCH_SIZE];
+  Random random;
+  for (int i = 0; i < _CHROMOSOME_SIZE * _BATCH_SIZE; ++i) {
+    angles[i] = static_cast<std::int8_t>(random.bounded(31) - 15);
+    thrusts[i] = static_cast<std::int8_t>(random.bounded(3) - 1);
+  }
+
+  double check{0.};
+  std::cout << "Physics, time per rocket step:" << std::endl;
+  std::cout << "  Rocket,      sin/cos: "
+            << timeScalar<TrigPhysics>(rocket, angles, thrusts, loops, check)
+            << "ns" << std::endl;
+  std::cout << "  Rocket,      table:   "
+            << timeScalar<TablePhysics>(rocket, angles, thrusts, loops, check)
+            << "ns" << std::endl;
+  std::cout << "  RocketBatch, sin/cos: "
+            << timeBatch<TrigPhysics>(rocket, angles, thrusts, loops, check)
+            << "ns" << std::endl;
+  std::cout << "  RocketBatch, table:   "
+            << timeBatch<TablePhysics>(rocket, angles, thrusts, loops, check)
+            << "ns" << std::endl;
+  std::cout << "  (checksum " << check << ")" << std::endl << std::endl;
+}
+
+//! @brief  Outcome of a flight, see `fly`.
+struct Flight {
+  double x[_CHROMOSOME_SIZE + 1]; //!< X coordinates, as long as alive.
+  double y[_CHROMOSOME_SIZE + 1]; //!< Y coordinates, as long as alive.
+  int steps;                      //!< Number of steps alive.
+  int floorId;                    //!< Crash segment, -1 if out of the map.
+  bool landed;                    //!< True if landed successfully.
+};
+
+//! @brief  Fly a rocket of the given scalar type along a chromosome, with the
+//!         collisions of `solve`.
+//!
+//! @tparam Real  Scalar type of the rocket and of the collision predicates.
+//!
+//! @param[in]  f_rocket      The initial rocket.
+//! @param[in]  f_geometry    Geometry of the level.
+//! @param[in]  f_chromosome  The chromosome to follow.
+//! @param[out] f_flight      The outcome.
+template <class Real>
+void fly(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+         const Chromosome &f_chromosome, Flight &f_flight) {
+  BasicRocket<Real> rocket{Real(f_rocket.x),  Real(f_rocket.y),
+                           Real(f_rocket.vx), Real(f_rocket.vy),
+                           f_rocket.angle,    f_rocket.thrust,
+                           f_rocket.fuel};
+  f_flight.x[0] = static_cast<double>(rocket.x);
+  f_flight.y[0] = static_cast<double>(rocket.y);
+  f_flight.steps = _CHROMOSOME_SIZE;
+  f_flight.floorId = -1;
+  f_flight.landed = false;
+  for (int gen = 0; gen < _CHROMOSOME_SIZE; ++gen) {
+    const Gene &gene{f_chromosome.chromosome[gen]};
+    rocket.updateRocket(gene.angle, gene.thrust);
+    f_flight.x[gen + 1] = static_cast<double>(rocket.x);
+    f_flight.y[gen + 1] = static_cast<double>(rocket.y);
+
+    if (rocket.x < Real(0) || rocket.x > Real(_w) || rocket.y < Real(0) ||
+        rocket.y > Real(_h)) {
+      f_flight.steps = gen + 1;
+      return;
+    }
+    const Line<Real> prev_curr{{rocket.pX, rocket.pY}, {rocket.x, rocket.y}};
+    for (int k = 1; k < f_geometry.size_floor; ++k) {
+      const Line_d &segment{f_geometry.segments[k]};
+      const Line<Real> floor{{Real(segment.p1.x), Real(segment.p1.y)},
+                             {Real(segment.p2.x), Real(segment.p2.y)}};
+      if (isIntersect(prev_curr, floor)) {
+        f_flight.steps = gen + 1;
+        f_flight.floorId = k;
+        f_flight.landed =
+            k == f_geometry.landing_zone_id && rocket.isParamSuccess();
+        return;
+      }
+    }
+  }
+}
+
+//! @brief  Compare the flights of a scalar type to the `double` ones, and
+//!         print the result.
+//!
+//! @tparam Real  Scalar type to compare.
+//!
+//! @param[in] f_name        Name of the scalar type.
+//! @param[in] f_levels      The levels.
+//! @param[in] f_chromosomes The chromosomes to fly on every level.
+template <class Real>
+void comparePrecision(const char *f_name, const Levels &f_levels,
+                      const std::vector<Chromosome> &f_chromosomes) {
+  static Flight reference;
+  static Flight flight;
+
+  std::cout << "  " << f_name << ":" << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    const Rocket &rocket{f_levels.getRocket(level)};
+    const LevelGeometry geometry(
+        f_levels.getFloor(level).data(),
+        static_cast<int>(f_levels.getSizeFloor(level)));
+
+    double max_diff{0.};
+    int crash_mismatches{0};
+    int landing_mismatches{0};
+    for (const Chromosome &chromosome : f_chromosomes) {
+      fly<double>(rocket, geometry, chromosome, reference);
+      fly<Real>(rocket, geometry, chromosome, flight);
+
+      for (int k = 0; k <= std::min(reference.steps, flight.steps); ++k) {
+        max_diff = std::max(max_diff, std::abs(flight.x[k] - reference.x[k]));
+        max_diff = std::max(max_diff, std::abs(flight.y[k] - reference.y[k]));
+      }
+      crash_mismatches += flight.floorId != reference.floorId ||
+                          flight.steps != reference.steps;
+      landing_mismatches += flight.landed != reference.landed;
+    }
+    std::cout << "    level " << level << ": max divergence " << max_diff
+              << "m, crash mismatches " << crash_mismatches
+              << ", landing mismatches " << landing_mismatches << std::endl;
+  }
+}
+
+/************************************************************/
+void benchmarkPrecision() {
+  constexpr int nb_chromosomes{1000};
+
+  // Same random chromosomes for every scalar type, on every level
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> angle_dist{-15, 15};
+  std::uniform_int_distribution<int> thrust_dist{-1, 1};
+  std::vector<Chromosome> chromosomes(nb_chromosomes);
+  for (Chromosome &chromosome : chromosomes) {
+    for (Gene &gene : chromosome.chromosome) {
+      gene.angle = static_cast<std::int8_t>(angle_dist(generator));
+      gene.thrust = static_cast<std::int8_t>(thrust_dist(generator));
+    }
+  }
+
+  const Levels levels;
+  std::cout << "Precision against double, " << nb_chromosomes
+            << " chromosomes per level:" << std::endl;
+  comparePrecision<float>("float", levels, chromosomes);
+  comparePrecision<Fixed>("fixed 48.16", levels, chromosomes);
+  std::cout << std::endl;
+}
+
+/************************************************************/
+void benchmarkCollision() {
+  constexpr int nb_steps{100000};
+  constexpr int nb_flights{1000};
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> x_dist{0., _w};
+  std::uniform_real_distribution<double> y_dist{0., _h};
+  std::uniform_real_distribution<double> d_dist{-150., 150.};
+  std::uniform_int_distribution<int> angle_dist{-15, 15};
+  std::uniform_int_distribution<int> thrust_dist{-1, 1};
+  std::vector<Line_d> steps(nb_steps);
+
+  const Levels levels;
+  std::cout << "Collisions, time per step:" << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    const LevelGeometry geometry(
+        levels.getFloor(level).data(),
+        static_cast<int>(levels.getSizeFloor(level)));
+    const int size_floor{geometry.size_floor};
+    const FloorIndex floor_index(geometry);
+
+    for (Line_d &step : steps) {
+      step.p1 = {x_dist(generator), y_dist(generator)};
+      step.p2 = {step.p1.x + d_dist(generator), step.p1.y + d_dist(generator)};
+    }
+
+    std::vector<int> expected(nb_steps, -1);
+    const double brute_sec{timeIt([&]() {
+      for (int i = 0; i < nb_steps; ++i) {
+        for (int k = 1; k < size_floor; ++k) {
+          if (isIntersect(steps[i], geometry.segments[k])) {
+            expected[i] = k;
+            break;
+          }
+        }
+      }
+    })};
+
+    std::vector<int> found(nb_steps, -1);
+    const double index_sec{timeIt([&]() {
+      for (int i = 0; i < nb_steps; ++i)
+        found[i] = floor_index.firstIntersection(steps[i]);
+    })};
+
+    int mismatches{0};
+    for (int i = 0; i < nb_steps; ++i)
+      mismatches += found[i] != expected[i];
+
+    // Steps of actual flights, until they leave the map or crash
+    FloorCounters counters;
+    for (int flight = 0; flight < nb_flights; ++flight) {
+      Rocket rocket{levels.getRocket(level)};
+      for (int gen = 0; gen < _CHROMOSOME_SIZE; ++gen) {
+        rocket.updateRocket(static_cast<std::int8_t>(angle_dist(generator)),
+                            static_cast<std::int8_t>(thrust_dist(generator)));
+        if (rocket.x < 0 || rocket.x > _w || rocket.y < 0 || rocket.y > _h ||
+            floor_index.firstIntersection(
+                {{rocket.pX, rocket.pY}, {rocket.x, rocket.y}},
+                &counters) != -1)
+          break;
+      }
+    }
+
+    std::cout << "  level " << level << ", " << size_floor - 1
+              << " segments: all " << 1e9 * brute_sec / nb_steps
+              << "ns, FloorIndex " << 1e9 * index_sec / nb_steps
+              << "ns, mismatches " << mismatches << ", flight steps above "
+              << "the envelope " << 100. * counters.getRejectionRate()
+              << "%" << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+/************************************************************/
+void benchmarkSegmentKernel() {
+  constexpr int nb_floors{1000};
+  constexpr int nb_segments{21};
+  constexpr int nb_steps{1000};
+
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> grid_dist{0, 8};
+  std::uniform_real_distribution<double> real_dist{0., 8.};
+  std::uniform_int_distribution<int> coin{0, 1};
+  auto coord = [&]() {
+    return coin(generator) ? static_cast<double>(grid_dist(generator))
+                           : real_dist(generator);
+  };
+
+  int mismatches{0};
+  int hits{0};
+  double scalar_sec{0.};
+  double kernel_sec{0.};
+  std::vector<Line_d> segments(nb_segments);
+  std::vector<Line_d> steps(nb_steps);
+  std::vector<int> expected(nb_steps);
+  std::vector<int> found(nb_steps);
+  for (int floor = 0; floor < nb_floors; ++floor) {
+    FloorSegments kernel;
+    for (Line_d &segment : segments) {
+      segment = {{coord(), coord()}, {coord(), coord()}};
+      kernel.push(segment);
+    }
+    for (Line_d &step : steps)
+      step = {{coord(), coord()}, {coord(), coord()}};
+
+    scalar_sec += timeIt([&]() {
+      for (int i = 0; i < nb_steps; ++i) {
+        expected[i] = -1;
+        for (int k = 0; k < nb_segments; ++k) {
+          if (isIntersect(steps[i], segments[k])) {
+            expected[i] = k;
+            break;
+          }
+        }
+      }
+    });
+    kernel_sec += timeIt([&]() {
+      for (int i = 0; i < nb_steps; ++i)
+        found[i] = kernel.firstIntersection(steps[i], 0, nb_segments);
+    });
+    for (int i = 0; i < nb_steps; ++i) {
+      mismatches += found[i] != expected[i];
+      hits += expected[i] != -1;
+
+      // Other range starts, so that every lane position is checked
+      const int begin{i % nb_segments};
+      int first{-1};
+      for (int k = begin; first == -1 && k < nb_segments; ++k) {
+        if (isIntersect(steps[i], segments[k]))
+          first = k;
+      }
+      mismatches +=
+          kernel.firstIntersection(steps[i], begin, nb_segments) != first;
+    }
+  }
+
+  const double nb_tests{static_cast<double>(nb_floors) * nb_steps};
+  std::cout << "Segment kernel, " << nb_segments
+            << " segments per step:" << std::endl;
+  std::cout << "  isIntersect: " << 1e9 * scalar_sec / nb_tests << "ns"
+            << std::endl;
+  std::cout << "  SIMD kernel: " << 1e9 * kernel_sec / nb_tests << "ns"
+            << std::endl;
+  std::cout << "  (" << hits << " hits, mismatches " << mismatches << ")"
+            << std::endl
+            << std::endl;
+}
+
+/************************************************************/
+void benchmarkSweptCollision() {
+  constexpr int nb_chromosomes{1000};
+
+  std::mt19937 generator{42};
+  std::uniform_int_distribution<int> angle_dist{-15, 15};
+  std::uniform_int_distribution<int> thrust_dist{-1, 1};
+  std::vector<Chromosome> chromosomes(nb_chromosomes);
+  for (Chromosome &chromosome : chromosomes) {
+    for (Gene &gene : chromosome.chromosome) {
+      gene.angle = static_cast<std::int8_t>(angle_dist(generator));
+      gene.thrust = static_cast<std::int8_t>(thrust_dist(generator));
+    }
+  }
+
+  const Levels levels;
+  static Trajectory trajectories[nb_chromosomes];
+  std::vector<Collision> expected(nb_chromosomes);
+  std::vector<Collision> found(nb_chromosomes);
+  std::cout << "Swept collisions, time per trajectory:" << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    const LevelGeometry geometry(
+        levels.getFloor(level).data(),
+        static_cast<int>(levels.getSizeFloor(level)));
+    const FloorIndex floor_index(geometry);
+    for (int i = 0; i < nb_chromosomes; ++i) {
+      StepEngine::simulate(levels.getRocket(level), chromosomes[i], 0,
+                           trajectories[i]);
+    }
+
+    const double step_sec{timeIt([&]() {
+      for (int i = 0; i < nb_chromosomes; ++i)
+        expected[i] = stepCollision(trajectories[i], floor_index);
+    })};
+    long long nb_checked_8{0};
+    const double swept_8_sec{timeIt([&]() {
+      for (int i = 0; i < nb_chromosomes; ++i)
+        found[i] = sweptCollision<8>(trajectories[i], floor_index,
+                                     nb_checked_8);
+    })};
+    int mismatches{0};
+    for (int i = 0; i < nb_chromosomes; ++i) {
+      mismatches += found[i].step != expected[i].step ||
+                    found[i].floorId != expected[i].floorId;
+    }
+    long long nb_checked_16{0};
+    const double swept_16_sec{timeIt([&]() {
+      for (int i = 0; i < nb_chromosomes; ++i)
+        found[i] = sweptCollision<16>(trajectories[i], floor_index,
+                                      nb_checked_16);
+    })};
+    long long nb_steps{0};
+    for (int i = 0; i < nb_chromosomes; ++i) {
+      mismatches += found[i].step != expected[i].step ||
+                    found[i].floorId != expected[i].floorId;
+      nb_steps += expected[i].step == -1 ? trajectories[i].size
+                                         : expected[i].step;
+    }
+
+    std::cout << "  level " << level << ": step "
+              << 1e9 * step_sec / nb_chromosomes << "ns, K=8 "
+              << 1e9 * swept_8_sec / nb_chromosomes << "ns ("
+              << 100. * nb_checked_8 / nb_steps << "% of the steps), K=16 "
+              << 1e9 * swept_16_sec / nb_chromosomes << "ns ("
+              << 100. * nb_checked_16 / nb_steps << "%), mismatches "
+              << mismatches << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+//! @brief  Run the genetic search on a level, without display, until a
+//!         landing. As the incremental search of `solve`, with a number of
+//!         generations instead of a timer: the first gene of the best
+//!         chromosome is played every `f_generations_per_gene` generations.
+//!
+//! @param[in] f_rocket               The initial rocket.
+//! @param[in] f_geometry             Geometry of the level.
+//! @param[in] f_floor_index          Floor index of the level.
+//! @param[in] f_field                Distance field scoring the crashes,
+//!                                   nullptr for the distance along the floor.
+//! @param[in] f_generations_per_gene Generations between two played genes.
+//! @param[in] f_max_generations      Number of generations to give up after.
+//! @param[in] f_seed                 Seed of the population.
+//! @param[in] f_cached               Whether or not to skip the flights of
+//!                                   the chromosomes still evaluated.
+//! @param[out] f_nbFlown             Number of chromosomes flown.
+//!
+//! @return The generation of the first landing, -1 if none.
+int generationsToSolution(const Rocket &f_rocket,
+                          const LevelGeometry &f_geometry,
+                          const FloorIndex &f_floor_index,
+                          const DistanceField *f_field,
+                          const int f_generations_per_gene,
+                          const int f_max_generations,
+                          const std::uint64_t f_seed, const bool f_cached,
+                          long long &f_nbFlown) {
+  GeneticPopulation population(f_rocket, f_geometry, f_field, f_seed);
+  Evaluator evaluator(f_floor_index, 1, true, false, f_cached);
+  int solution{-1};
+  int idxStart{0};
+  for (int generation = 1; generation <= f_max_generations; ++generation) {
+    if (generation % f_generations_per_gene == 0) {
+      const Gene *bestGen{population.getRanked(0)->getGene(idxStart)};
+      Rocket &rocket{population.rocket_save};
+      rocket.updateRocket(bestGen->angle, bestGen->thrust);
+      if (rocket.x < 0 || rocket.x > _w || rocket.y < 0 || rocket.y > _h ||
+          f_floor_index.firstIntersection(
+              {{rocket.pX, rocket.pY}, {rocket.x, rocket.y}}) != -1)
+        break;
+      population.advance(idxStart++);
+    }
+
+    if (evaluator.evaluate(population, idxStart).chromosome != -1) {
+      solution = generation;
+      break;
+    }
+    population.mutate(idxStart);
+  }
+  f_nbFlown += evaluator.nb_flown;
+  return solution;
+}
+
+/************************************************************/
+void benchmarkDistanceField() {
+  constexpr int nb_queries{1000000};
+  constexpr int nb_runs{5};
+  constexpr int generations_per_gene{20};
+  constexpr int max_generations{2000};
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> x_dist{0., _w};
+  std::uniform_real_distribution<double> y_dist{0., _h};
+  std::vector<double> xs(nb_queries);
+  std::vector<double> ys(nb_queries);
+  for (int i = 0; i < nb_queries; ++i) {
+    xs[i] = x_dist(generator);
+    ys[i] = y_dist(generator);
+  }
+
+  const Levels levels;
+  std::cout << "Geodesic distance field, then generations to a landing over "
+            << nb_runs << " runs, a gene played every " << generations_per_gene
+            << " generations, distance along the floor against geodesic "
+               "distance:"
+            << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    const LevelGeometry geometry(
+        levels.getFloor(level).data(),
+        static_cast<int>(levels.getSizeFloor(level)));
+    const FloorIndex floor_index(geometry);
+
+    double check{0.};
+    const double build_sec{
+        timeIt([&]() { check += DistanceField(geometry).max_distance; })};
+    const DistanceField field(geometry);
+    const double query_sec{timeIt([&]() {
+      for (int i = 0; i < nb_queries; ++i)
+        check += field.at(xs[i], ys[i]);
+    })};
+
+    // Same initial populations for both scores
+    int solved[2]{0, 0};
+    int generations[2]{0, 0};
+    long long nb_flown{0};
+    for (int run = 0; run < nb_runs; ++run) {
+      for (int geodesic = 0; geodesic < 2; ++geodesic) {
+        const int generation{generationsToSolution(
+            levels.getRocket(level), geometry, floor_index,
+            geodesic ? &field : nullptr, generations_per_gene,
+            max_generations, run + 1, true, nb_flown)};
+        if (generation != -1) {
+          ++solved[geodesic];
+          generations[geodesic] += generation;
+        }
+      }
+    }
+
+    std::cout << "  level " << level << ": built in " << 1e3 * build_sec
+              << "ms, query " << 1e9 * query_sec / nb_queries
+              << "ns (check " << check << ")" << std::endl;
+    for (int geodesic = 0; geodesic < 2; ++geodesic) {
+      std::cout << (geodesic ? "    geodesic: " : "    floor:    ")
+                << solved[geodesic] << "/" << nb_runs << " landed";
+      if (solved[geodesic] > 0)
+        std::cout << ", " << static_cast<double>(generations[geodesic]) /
+                                 solved[geodesic]
+                  << " generations on average";
+      std::cout << std::endl;
+    }
+  }
+  std::cout << std::endl;
+}
+
+//! @brief  Time the selection of one generation: the build, then one draw
+//!         per chromosome.
+//!
+//! @tparam Selection  The selection policy.
+//!
+//! @param[in]  f_fitness  Fitness of the chromosomes, the elites first.
+//! @param[out] f_check    Sum of the drawn indexes, so that nothing is
+//!                        skipped.
+//!
+//! @return The time per generation, in us.
+template <class Selection>
+double timeSelection(const std::vector<double> &f_fitness, long long &f_check) {
+  const int size{static_cast<int>(f_fitness.size())};
+  const int loops{std::max(1, 1000000 / size)};
+  Selection selection;
+  Random random;
+  const double sec{timeIt([&]() {
+    for (int loop = 0; loop < loops; ++loop) {
+      selection.build(f_fitness.data(), size);
+      for (int i = 0; i < size; ++i)
+        f_check += selection.draw(random);
+    }
+  })};
+  return 1e6 * sec / loops;
+}
+
+//! @brief  Get the total variation distance between the draws of a selection
+//!         policy and the fitness proportional distribution.
+//!
+//! @tparam Selection  The selection policy.
+//!
+//! @param[in] f_fitness  Fitness of the chromosomes, the elites first.
+//! @param[in] f_draws    Number of draws.
+//!
+//! @return The distance, in [0, 1].
+template <class Selection>
+double selectionBias(const std::vector<double> &f_fitness, const int f_draws) {
+  const int size{static_cast<int>(f_fitness.size())};
+  Selection selection;
+  Random random;
+  selection.build(f_fitness.data(), size);
+  std::vector<int> counts(size, 0);
+  for (int i = 0; i < f_draws; ++i)
+    ++counts[selection.draw(random)];
+
+  double sum_fitness{0.};
+  for (const double fitness : f_fitness)
+    sum_fitness += fitness;
+  double distance{0.};
+  for (int i = 0; i < size; ++i) {
+    distance += std::abs(static_cast<double>(counts[i]) / f_draws -
+                         f_fitness[i] / sum_fitness);
+  }
+  return 0.5 * distance;
+}
+
+/************************************************************/
+void benchmarkSelection() {
+  constexpr int sizes[]{100, 1000, 10000, 100000};
+  constexpr int max_linear_size{10000};
+  constexpr int nb_draws{1000000};
+
+  // Crash scores of random distances, as ranked by `mutate`: the elites
+  // first, sorted, the others in any order
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> d_dist{0., 5000.};
+  std::vector<double> fitness;
+
+  std::cout << "Selection, time per generation (build and one draw per "
+               "chromosome):"
+            << std::endl;
+  long long check{0};
+  for (const int size : sizes) {
+    fitness.resize(size);
+    for (double &value : fitness)
+      value = 1000. / (1. + 0.009999 * d_dist(generator));
+    const int nb_elites{std::max(1, static_cast<int>(_ELITISM_RATIO * size))};
+    std::partial_sort(fitness.begin(), fitness.begin() + nb_elites,
+                      fitness.end(), std::greater<double>());
+
+    std::cout << "  N=" << size << ": linear ";
+    if (size <= max_linear_size)
+      std::cout << timeSelection<LinearSelection>(fitness, check) << "us";
+    else
+      std::cout << "skipped";
+    std::cout << ", binary search "
+              << timeSelection<BinarySearchSelection>(fitness, check)
+              << "us, alias " << timeSelection<AliasSelection>(fitness, check)
+              << "us, tournament "
+              << timeSelection<TournamentSelection>(fitness, check) << "us"
+              << std::endl;
+    if (size == sizes[0]) {
+      std::cout << "    distance to the fitness proportional draws over "
+                << nb_draws << " draws: linear "
+                << selectionBias<LinearSelection>(fitness, nb_draws)
+                << ", binary search "
+                << selectionBias<BinarySearchSelection>(fitness, nb_draws)
+                << ", alias "
+                << selectionBias<AliasSelection>(fitness, nb_draws)
+                << std::endl;
+    }
+  }
+  std::cout << "  (check " << check << ")" << std::endl << std::endl;
+}
+
+/************************************************************/
+void benchmarkRandom() {
+  constexpr int nb_values{1 << 24};
+  constexpr int nb_chromosomes{10000};
+
+  static std::uint32_t values[nb_values];
+  Random random;
+  long long check{0};
+
+  std::cout << "Random numbers, time per value:" << std::endl;
+  const double rand_sec{timeIt([&]() {
+    for (int i = 0; i < nb_values; ++i)
+      values[i] = static_cast<std::uint32_t>(rand() % 31);
+  })};
+  check += values[nb_values - 1];
+  const double bounded_sec{timeIt([&]() {
+    for (int i = 0; i < nb_values; ++i)
+      values[i] = static_cast<std::uint32_t>(random.bounded(31));
+  })};
+  check += values[nb_values - 1];
+  const double fill_sec{
+      timeIt([&]() { random.fillBounded(values, nb_values, 31); })};
+  check += values[nb_values - 1];
+  std::cout << "  rand() % 31:          " << 1e9 * rand_sec / nb_values
+            << "ns" << std::endl;
+  std::cout << "  Random::bounded:      " << 1e9 * bounded_sec / nb_values
+            << "ns" << std::endl;
+  std::cout << "  Random::fillBounded:  " << 1e9 * fill_sec / nb_values
+            << "ns" << std::endl;
+
+  // Same seed, same chromosomes
+  Random first{7};
+  Random second{7};
+  int mismatches{0};
+  const double chromosome_sec{timeIt([&]() {
+    for (int i = 0; i < nb_chromosomes; ++i) {
+      const Chromosome a(first, 0, 0);
+      const Chromosome b(second, 0, 0);
+      for (int g = 0; g < _CHROMOSOME_SIZE; ++g) {
+        mismatches += a.chromosome[g].angle != b.chromosome[g].angle ||
+                      a.chromosome[g].thrust != b.chromosome[g].thrust;
+      }
+    }
+  })};
+  std::cout << "  random chromosome:    "
+            << 1e9 * chromosome_sec / (2 * nb_chromosomes)
+            << "ns, same seed mismatches " << mismatches << " (check "
+            << check << ")" << std::endl
+            << std::endl;
+}
+
+/************************************************************/
+void benchmarkCrossover() {
+  constexpr int nb_loops{1000};
+  constexpr int nb_pairs{_POPULATION_SIZE / 2};
+  constexpr int nb_genes{_CHROMOSOME_SIZE};
+  constexpr int threshold{static_cast<int>(_MUTATION_RATE * 65536)};
+
+  // Random parents, and the random values of every pair of children
+  Random random;
+  std::vector<Gene> parents(2 * _POPULATION_SIZE * nb_genes);
+  for (Gene &gene : parents) {
+    gene = {static_cast<std::int8_t>(random.bounded(31) - 15),
+            static_cast<std::int8_t>(random.bounded(3) - 1)};
+  }
+  std::vector<std::uint32_t> bits(5 * nb_pairs * nb_genes);
+  for (int pair = 0; pair < nb_pairs; ++pair) {
+    std::uint32_t *pair_bits{&bits[5 * pair * nb_genes]};
+    random.fill(pair_bits, nb_genes);
+    for (int child = 0; child < 2; ++child) {
+      random.fillBounded(&pair_bits[(1 + 2 * child) * nb_genes], nb_genes, 31);
+      random.fillBounded(&pair_bits[(2 + 2 * child) * nb_genes], nb_genes, 3);
+    }
+  }
+
+  // Every pair of a population, with either kernel
+  std::vector<Gene> expected(_POPULATION_SIZE * nb_genes);
+  std::vector<Gene> found(_POPULATION_SIZE * nb_genes);
+  const auto breed = [&](const bool f_scalar, std::vector<Gene> &f_children) {
+    for (int pair = 0; pair < nb_pairs; ++pair) {
+      const Gene *parent1{&parents[2 * pair * nb_genes]};
+      const Gene *parent2{&parents[(2 * pair + 1) * nb_genes]};
+      Gene *child1{&f_children[2 * pair * nb_genes]};
+      Gene *child2{&f_children[(2 * pair + 1) * nb_genes]};
+      const std::uint32_t *pair_bits{&bits[5 * pair * nb_genes]};
+      if (f_scalar) {
+        crossoverGenesScalar(parent1, parent2, child1, child2, nb_genes,
+                             pair_bits, threshold, 15, 1);
+      } else {
+        crossoverGenes(parent1, parent2, child1, child2, nb_genes, pair_bits,
+                       threshold, 15, 1);
+      }
+    }
+  };
+  const double scalar_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop)
+      breed(true, expected);
+  })};
+  const double kernel_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop)
+      breed(false, found);
+  })};
+
+  int mismatches{0};
+  for (std::size_t g = 0; g < found.size(); ++g) {
+    mismatches += found[g].angle != expected[g].angle ||
+                  found[g].thrust != expected[g].thrust;
+  }
+  std::cout << "Crossover of " << _POPULATION_SIZE << " chromosomes of "
+            << nb_genes << " genes, time per population:" << std::endl;
+  std::cout << "  scalar: " << 1e6 * scalar_sec / nb_loops << "us"
+            << std::endl;
+  std::cout << "  kernel: " << 1e6 * kernel_sec / nb_loops << "us (x"
+            << scalar_sec / kernel_sec << "), mismatches " << mismatches
+            << std::endl
+            << std::endl;
+}
+
+//! @brief  Time the reads of the genes of a population.
+//!
+//! @param[in]  f_rows    First gene of every chromosome, in the order of the
+//!                       population.
+//! @param[in]  f_size    Genes per chromosome.
+//! @param[in]  f_loops   Number of repetitions.
+//! @param[out] f_column  Time per gene read gene after gene, in ns.
+//! @param[out] f_row     Time per gene read chromosome after chromosome, in
+//!                       ns.
+//! @param[out] f_check   Sum of the genes, so that nothing is skipped.
+void timeGeneReads(const std::vector<const Gene *> &f_rows, const int f_size,
+                   const int f_loops, double &f_column, double &f_row,
+                   long long &f_check) {
+  const double nb_reads{static_cast<double>(f_loops) * f_rows.size() *
+                        f_size};
+  f_column = 1e9 *
+             timeIt([&]() {
+               for (int loop = 0; loop < f_loops; ++loop) {
+                 for (int g = 0; g < f_size; ++g) {
+                   for (const Gene *row : f_rows)
+                     f_check += row[g].angle + row[g].thrust;
+                 }
+               }
+             }) /
+             nb_reads;
+  f_row = 1e9 *
+          timeIt([&]() {
+            for (int loop = 0; loop < f_loops; ++loop) {
+              for (const Gene *row : f_rows) {
+                for (int g = 0; g < f_size; ++g)
+                  f_check += row[g].angle + row[g].thrust;
+              }
+            }
+          }) /
+          nb_reads;
+}
+
+/************************************************************/
+void benchmarkGeneMatrix() {
+  constexpr int nb_genes{10000000};
+  constexpr int population_sizes[]{_POPULATION_SIZE, 10 * _POPULATION_SIZE,
+                                   100 * _POPULATION_SIZE};
+  constexpr int line{64};
+
+  std::cout << "Genes of the populations, a vector per chromosome then a "
+               "matrix: cache lines per chromosome, and time per gene read "
+               "gene after gene, then chromosome after chromosome:"
+            << std::endl;
+  long long check{0};
+  for (const int population_size : population_sizes) {
+    const int loops{
+        std::max(1, nb_genes / (population_size * _CHROMOSOME_SIZE))};
+
+    // Two populations of slots, the current one in any order after a few
+    // generations
+    std::vector<int> slots(2 * population_size);
+    std::iota(slots.begin(), slots.end(), 0);
+    std::shuffle(slots.begin(), slots.end(), std::mt19937{42});
+    slots.resize(population_size);
+
+    std::vector<std::vector<Gene>> vectors(2 * population_size,
+                                           std::vector<Gene>(_CHROMOSOME_SIZE));
+    GeneMatrix matrix(2 * population_size, _CHROMOSOME_SIZE);
+    std::vector<const Gene *> layouts[2];
+    for (const int slot : slots) {
+      layouts[0].push_back(vectors[slot].data());
+      layouts[1].push_back(matrix.row(slot).data());
+    }
+
+    std::cout << "  " << population_size << " chromosomes:";
+    const char *names[2]{"vectors", "matrix"};
+    for (int l = 0; l < 2; ++l) {
+      long long nb_lines{0};
+      for (const Gene *row : layouts[l]) {
+        const std::uintptr_t begin{reinterpret_cast<std::uintptr_t>(row)};
+        const std::uintptr_t end{begin + _CHROMOSOME_SIZE * sizeof(Gene)};
+        nb_lines += (end - 1) / line - begin / line + 1;
+      }
+      double column_ns{0.};
+      double row_ns{0.};
+      timeGeneReads(layouts[l], _CHROMOSOME_SIZE, loops, column_ns, row_ns,
+                    check);
+      std::cout << " " << names[l] << " "
+                << static_cast<double>(nb_lines) / population_size
+                << " lines " << column_ns << "ns " << row_ns << "ns"
+                << (l == 0 ? "," : "");
+    }
+    std::cout << std::endl;
+  }
+  std::cout << "  (check " << check << ")" << std::endl << std::endl;
+}
+
+/************************************************************/
+void benchmarkPackedGenes() {
+  constexpr int nb_chromosomes{10000};
+  constexpr int nb_genes{400};
+  constexpr int nb_loops{10};
+
+  // Random genes, over their whole ranges
+  Random random;
+  GeneMatrix genes(nb_chromosomes, nb_genes);
+  for (int i = 0; i < nb_chromosomes; ++i) {
+    for (Gene &gene : genes.row(i)) {
+      gene = {static_cast<std::int8_t>(random.bounded(31) - 15),
+              static_cast<std::int8_t>(random.bounded(3) - 1)};
+    }
+  }
+  PackedGeneMatrix packed(nb_chromosomes, nb_genes);
+  GeneMatrix unpacked(nb_chromosomes, nb_genes);
+
+  const double pack_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop) {
+      for (int i = 0; i < nb_chromosomes; ++i)
+        packGenes(genes.row(i).data(), packed.row(i), nb_genes);
+    }
+  })};
+  const double unpack_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop) {
+      for (int i = 0; i < nb_chromosomes; ++i)
+        unpackGenes(packed.row(i), unpacked.row(i).data(), nb_genes);
+    }
+  })};
+
+  // The lanes against one gene at a time, and the round trip
+  int mismatches{0};
+  for (int i = 0; i < nb_chromosomes; ++i) {
+    const GeneRow row{genes.row(i)};
+    const GeneRow back{unpacked.row(i)};
+    for (int g = 0; g < nb_genes; ++g) {
+      mismatches += packed.row(i)[g] != packGene(row[g]) ||
+                    back[g].angle != row[g].angle ||
+                    back[g].thrust != row[g].thrust;
+    }
+  }
+
+  // A read of every gene, unpacked on the fly
+  long long check{0};
+  const double read_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop) {
+      for (int i = 0; i < nb_chromosomes; ++i) {
+        for (const Gene &gene : genes.row(i))
+          check += gene.angle + gene.thrust;
+      }
+    }
+  })};
+  const double read_packed_sec{timeIt([&]() {
+    for (int loop = 0; loop < nb_loops; ++loop) {
+      for (int i = 0; i < nb_chromosomes; ++i) {
+        const PackedGene *row{packed.row(i)};
+        for (int g = 0; g < nb_genes; ++g) {
+          const Gene gene{unpackGene(row[g])};
+          check += gene.angle + gene.thrust;
+        }
+      }
+    }
+  })};
+
+  const double nb_reads{static_cast<double>(nb_loops) * nb_chromosomes *
+                        nb_genes};
+  std::cout << "Genes of " << nb_chromosomes << " chromosomes of " << nb_genes
+            << " genes, as a matrix then packed:" << std::endl;
+  std::cout << "  memory: "
+            << static_cast<double>(nb_chromosomes) * genes.stride *
+                   sizeof(Gene) / (1 << 20)
+            << "MB, packed "
+            << static_cast<double>(nb_chromosomes) * packed.stride /
+                   (1 << 20)
+            << "MB" << std::endl;
+  std::cout << "  pack " << 1e9 * pack_sec / nb_reads << "ns, unpack "
+            << 1e9 * unpack_sec / nb_reads << "ns per gene, mismatches "
+            << mismatches << std::endl;
+  std::cout << "  read " << 1e9 * read_sec / nb_reads << "ns, packed "
+            << 1e9 * read_packed_sec / nb_reads << "ns per gene (check "
+            << check << ")" << std::endl
+            << std::endl;
+}
+
+//! @brief  Time the generations of a configuration on a level: every
+//!         chromosome flown by an `Evaluator` in swept mode, then the
+//!         mutation.
+//!
+//! @param[in]  f_rocket       The initial rocket.
+//! @param[in]  f_geometry     Geometry of the level.
+//! @param[in]  f_floor_index  Floor index of the level.
+//! @param[in]  f_config       Dimensions and rates of the population.
+//! @param[in]  f_generations  Number of generations.
+//! @param[out] f_mutation     Time of the mutations per gene, in ns.
+//!
+//! @return The time of the generations per gene, in ns.
+double timeGenerations(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+                       const FloorIndex &f_floor_index,
+                       const GeneticConfig &f_config, const int f_generations,
+                       double &f_mutation) {
+  GeneticPopulation population(f_rocket, f_geometry, nullptr, _RANDOM_SEED,
+                               f_config);
+  Evaluator evaluator(f_floor_index, 1, true, false, false);
+  double mutation_sec{0.};
+  const double sec{timeIt([&]() {
+    for (int generation = 0; generation < f_generations; ++generation) {
+      evaluator.evaluate(population, 0);
+      mutation_sec += timeIt([&]() { population.mutate(0); });
+    }
+  })};
+
+  const double nb_genes{static_cast<double>(f_generations) *
+                        f_config.population_size * f_config.chromosome_size};
+  f_mutation = 1e9 * mutation_sec / nb_genes;
+  return 1e9 * sec / nb_genes;
+}
+
+/************************************************************/
+void benchmarkConfig() {
+  constexpr int nb_genes{20000000};
+
+  // The default dimensions, then one gene more, left over by the lanes
+  GeneticConfig configs[4];
+  configs[1].chromosome_size = _CHROMOSOME_SIZE + 1;
+  configs[2].chromosome_size = 4 * _CHROMOSOME_SIZE;
+  configs[3].population_size = 100 * _POPULATION_SIZE;
+
+  const Levels levels;
+  const Rocket rocket{levels.getRocket(2)};
+  const std::vector<int> floor{levels.getFloor(2)};
+  const LevelGeometry geometry(floor.data(), levels.getSizeFloor(2));
+  const FloorIndex floor_index(geometry);
+
+  std::cout << "Generations of runtime dimensions on level 2, time per gene "
+               "(simulation and mutation, then mutation only):"
+            << std::endl;
+  for (const GeneticConfig &config : configs) {
+    const int generations{std::max(
+        1, nb_genes / (config.population_size * config.chromosome_size))};
+    double mutation;
+    const double generation{timeGenerations(rocket, geometry, floor_index,
+                                            config, generations, mutation)};
+    std::cout << "  " << config.population_size << " chromosomes of "
+              << config.chromosome_size << " genes: " << generation << "ns, "
+              << mutation << "ns" << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+//! @brief  Value counting the bytes written by its copies.
+//!
+//! @tparam T  Type of the value.
+template <class T> struct Counted {
+  T value; //!< The value.
+
+  static long long bytes; //!< Bytes written by every copy so far.
+
+  Counted() = default;
+  Counted(const Counted &f_other) : value(f_other.value) {
+    bytes += sizeof(T);
+  }
+  Counted &operator=(const Counted &f_other) {
+    value = f_other.value;
+    bytes += sizeof(T);
+    return *this;
+  }
+};
+
+template <class T> long long Counted<T>::bytes{0};
+
+//! @brief  Chromosome of the default size holding its genes by value, as
+//!         sorted and copied by `mutate` before the slots.
+struct ChromosomeByValue {
+  Gene chromosome[_CHROMOSOME_SIZE]; //!< Genes of the chromosome.
+  double fitness;                    //!< Fitness score of the chromosome.
+};
+
+/************************************************************/
+void benchmarkRanking() {
+  constexpr int sizes[]{100, 1000, 10000};
+  constexpr int nb_sorted{1000000};
+
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> d_dist{0., 5000.};
+
+  std::cout << "Ranking and elitism of one generation, sorting the "
+               "chromosomes by value against ranking the elite slots:"
+            << std::endl;
+  for (const int size : sizes) {
+    const int generations{std::max(1, nb_sorted / size)};
+    const int elitism_idx{static_cast<int>(_ELITISM_RATIO * size)};
+    std::vector<double> fitness(2 * size);
+
+    std::vector<Counted<ChromosomeByValue>> by_value(size);
+    std::vector<Counted<ChromosomeByValue>> next_by_value(size);
+    std::vector<Counted<int>> slots(size);
+    std::vector<Counted<int>> ranking(size);
+    std::vector<Counted<int>> next_slots(size);
+    std::vector<Counted<int>> spare(size);
+    for (int i = 0; i < size; ++i) {
+      slots[i].value = i;
+      spare[i].value = size + i;
+    }
+
+    double sec_by_value{0.};
+    double sec_slots{0.};
+    Counted<ChromosomeByValue>::bytes = 0;
+    Counted<int>::bytes = 0;
+    for (int generation = 0; generation < generations; ++generation) {
+      for (int i = 0; i < size; ++i) {
+        by_value[i].value.fitness = 1000. / (1. + 0.009999 * d_dist(generator));
+        fitness[slots[i].value] = by_value[i].value.fitness;
+      }
+
+      sec_by_value += timeIt([&]() {
+        std::sort(by_value.begin(), by_value.end(),
+                  [](const Counted<ChromosomeByValue> &lhs,
+                     const Counted<ChromosomeByValue> &rhs) {
+                    return lhs.value.fitness > rhs.value.fitness;
+                  });
+        for (int i = 0; i < elitism_idx; ++i)
+          next_by_value[i] = by_value[i];
+      });
+
+      sec_slots += timeIt([&]() {
+        std::copy(slots.begin(), slots.end(), ranking.begin());
+        std::partial_sort(
+            ranking.begin(), ranking.begin() + std::max(1, elitism_idx),
+            ranking.end(),
+            [&](const Counted<int> &lhs, const Counted<int> &rhs) {
+              return fitness[lhs.value] > fitness[rhs.value];
+            });
+        for (int i = 0; i < elitism_idx; ++i)
+          next_slots[i] = ranking[i];
+        for (int i = elitism_idx; i < size; ++i)
+          next_slots[i] = spare[i - elitism_idx];
+        std::copy(ranking.begin() + elitism_idx, ranking.end(), spare.begin());
+        std::swap(slots, next_slots);
+      });
+    }
+
+    std::cout << "  N=" << size << ": by value "
+              << Counted<ChromosomeByValue>::bytes / generations << " bytes, "
+              << 1e6 * sec_by_value / generations << "us, slots "
+              << Counted<int>::bytes / generations << " bytes, "
+              << 1e6 * sec_slots / generations << "us" << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+/************************************************************/
+void benchmarkEvaluationCache() {
+  constexpr int generations_per_gene{20};
+  constexpr int max_generations{500};
+
+  const Levels levels;
+  std::cout << "Genetic search of " << max_generations
+            << " generations at most, flying every chromosome against "
+               "skipping the ones still evaluated:"
+            << std::endl;
+  int mismatches{0};
+  for (int level = 1; level <= 7; ++level) {
+    const std::vector<int> floor{levels.getFloor(level)};
+    const LevelGeometry geometry(floor.data(), levels.getSizeFloor(level));
+    const FloorIndex floor_index(geometry);
+
+    int generations[2];
+    long long nb_flown[2]{0, 0};
+    double sec[2];
+    for (int cached = 0; cached < 2; ++cached) {
+      sec[cached] = timeIt([&]() {
+        generations[cached] = generationsToSolution(
+            levels.getRocket(level), geometry, floor_index, nullptr,
+            generations_per_gene, max_generations, _RANDOM_SEED, cached != 0,
+            nb_flown[cached]);
+      });
+    }
+    mismatches += generations[0] != generations[1];
+
+    std::cout << "  level " << level << ": every chromosome " << sec[0]
+              << "s, cached " << sec[1] << "s, "
+              << 100. * nb_flown[1] / nb_flown[0] << "% of the chromosomes "
+              << "flown" << std::endl;
+  }
+  std::cout << "  generations to a landing mismatches " << mismatches
+            << std::endl
+            << std::endl;
+}
+
+/************************************************************/
+void benchmarkPrefixTree() {
+  constexpr int generations_per_gene{20};
+  constexpr int nb_generations{200};
+  constexpr int reported[]{1, 10, 50, 100, 200};
+
+  const Levels levels;
+  std::cout << "Genetic search of " << nb_generations
+            << " generations, share of the steps read from the prefix tree "
+               "at some generations, then on average, and time of the "
+               "flights against the rockets stepped all together:"
+            << std::endl;
+  int mismatches{0};
+  for (int level = 1; level <= 7; ++level) {
+    const std::vector<int> floor{levels.getFloor(level)};
+    const LevelGeometry geometry(floor.data(), levels.getSizeFloor(level));
+    const FloorIndex floor_index(geometry);
+
+    GeneticPopulation population(levels.getRocket(level), geometry);
+    Evaluator tree(floor_index, 1, false, true, false);
+    Evaluator steps(floor_index, 1, false, false, false);
+    std::vector<Rocket> expected(population.config.population_size);
+    int idxStart{0};
+    double tree_sec{0.};
+    double step_sec{0.};
+    long long nb_steps{0};
+    long long nb_shared_steps{0};
+
+    // Until a landing
+    bool landed{false};
+    std::cout << "  level " << level << ":";
+    for (int generation = 1; !landed && generation <= nb_generations;
+         ++generation) {
+      if (generation % generations_per_gene == 0) {
+        const Gene *bestGen{population.getRanked(0)->getGene(idxStart)};
+        population.rocket_save.updateRocket(bestGen->angle, bestGen->thrust);
+        population.advance(idxStart++);
+      }
+
+      // The same rockets, up to the first one landed: both skip the next
+      Landing reference;
+      step_sec +=
+          timeIt([&]() { reference = steps.evaluate(population, idxStart); });
+      for (int chrom = 0; chrom < population.config.population_size; ++chrom)
+        expected[chrom] = *population.getRocket(chrom);
+      const EvaluationCounters before{tree.getCounters()};
+      Landing landing;
+      tree_sec +=
+          timeIt([&]() { landing = tree.evaluate(population, idxStart); });
+      const EvaluationCounters after{tree.getCounters()};
+      landed = landing.chromosome != -1;
+
+      mismatches += landing.chromosome != reference.chromosome ||
+                    landing.gene != reference.gene ||
+                    landing.fuel != reference.fuel;
+      const int nb_compared{landed ? landing.chromosome + 1
+                                   : population.config.population_size};
+      for (int chrom = 0; chrom < nb_compared; ++chrom) {
+        const Rocket &flown{*population.getRocket(chrom)};
+        const Rocket &stepped{expected[chrom]};
+        mismatches += flown.isAlive != stepped.isAlive ||
+                      flown.floor_id_crash != stepped.floor_id_crash ||
+                      flown.x != stepped.x || flown.y != stepped.y ||
+                      flown.vx != stepped.vx || flown.vy != stepped.vy ||
+                      flown.fuel != stepped.fuel;
+      }
+
+      const long long generation_steps{after.nb_prefix_steps -
+                                       before.nb_prefix_steps};
+      const long long generation_shared{after.nb_shared_steps -
+                                        before.nb_shared_steps};
+      nb_steps += generation_steps;
+      nb_shared_steps += generation_shared;
+      if (std::find(std::begin(reported), std::end(reported), generation) !=
+          std::end(reported))
+        std::cout << " " << 100. * generation_shared / generation_steps << "%";
+
+      if (landed)
+        std::cout << " landed at generation " << generation;
+      else
+        population.mutate(idxStart);
+    }
+    std::cout << ", average " << 100. * nb_shared_steps / nb_steps
+              << "%, tree " << tree_sec << "s, steps " << step_sec << "s"
+              << std::endl;
+  }
+  std::cout << "  mismatches " << mismatches << std::endl << std::endl;
+}
+
+//! @brief  Run generations of the genetic search until a landing, the
+//!         chromosomes flown by an `Evaluator` on a pool of workers, as
+//!         `solve` does in swept mode.
+//!
+//! @param[in]  f_rocket       The initial rocket.
+//! @param[in]  f_geometry     Geometry of the level.
+//! @param[in]  f_floor_index  Floor index of the level.
+//! @param[in]  f_config       Dimensions and rates of the population.
+//! @param[in]  f_nb_workers   Number of workers.
+//! @param[in]  f_generations  Maximum number of generations.
+//! @param[out] f_rockets      Rockets of the last generation, up to the
+//!                            chromosome landed if any: the workers skip the
+//!                            ones after it.
+//!
+//! @return The time of the flights, in seconds.
+double timeWorkers(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+                   const FloorIndex &f_floor_index,
+                   const GeneticConfig &f_config, const int f_nb_workers,
+                   const int f_generations, std::vector<Rocket> &f_rockets) {
+  GeneticPopulation population(f_rocket, f_geometry, nullptr, _RANDOM_SEED,
+                               f_config);
+  ThreadPool pool(f_nb_workers);
+  Evaluator evaluator(f_floor_index, pool.size(), true, false);
+
+  // Until a landing
+  Landing landing;
+  double sec{0.};
+  for (int generation = 0; generation < f_generations; ++generation) {
+    sec += timeIt(
+        [&]() { landing = evaluator.evaluate(population, 0, &pool); });
+    if (landing.chromosome != -1)
+      break;
+    population.mutate(0);
+  }
+
+  const int nb_rockets{landing.chromosome == -1 ? f_config.population_size
+                                                : landing.chromosome + 1};
+  f_rockets.clear();
+  for (int chrom = 0; chrom < nb_rockets; ++chrom)
+    f_rockets.push_back(*population.getRocket(chrom));
+  return sec;
+}
+
+/************************************************************/
+void benchmarkThreads() {
+  constexpr int nb_genes{10000000};
+  constexpr int population_sizes[]{_POPULATION_SIZE, 10 * _POPULATION_SIZE};
+
+  // 1, 2, 4... workers, then one per hardware thread
+  const int nb_hardware{
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()))};
+  std::vector<int> nb_workers;
+  for (int n = 1; n < nb_hardware; n *= 2)
+    nb_workers.push_back(n);
+  nb_workers.push_back(nb_hardware);
+
+  const Levels levels;
+  std::cout << "Generations of the genetic search on every level, time of the "
+               "flights with 1 to "
+            << nb_hardware << " workers, and speedup:" << std::endl;
+  int mismatches{0};
+  for (const int population_size : population_sizes) {
+    GeneticConfig config;
+    config.population_size = population_size;
+    const int generations{std::max(
+        1, nb_genes / (config.population_size * config.chromosome_size))};
+
+    std::vector<double> sec(nb_workers.size(), 0.);
+    for (int level = 1; level <= 7; ++level) {
+      const Rocket rocket{levels.getRocket(level)};
+      const std::vector<int> floor{levels.getFloor(level)};
+      const LevelGeometry geometry(floor.data(), levels.getSizeFloor(level));
+      const FloorIndex floor_index(geometry);
+
+      // The same generations whatever the workers
+      std::vector<Rocket> expected;
+      std::vector<Rocket> found;
+      for (std::size_t i = 0; i < nb_workers.size(); ++i) {
+        sec[i] += timeWorkers(rocket, geometry, floor_index, config,
+                              nb_workers[i], generations,
+                              i == 0 ? expected : found);
+        if (i == 0)
+          continue;
+        mismatches += found.size() != expected.size();
+        for (std::size_t k = 0;
+             k < std::min(found.size(), expected.size()); ++k) {
+          mismatches += found[k].x != expected[k].x ||
+                        found[k].y != expected[k].y ||
+                        found[k].fuel != expected[k].fuel ||
+                        found[k].floor_id_crash != expected[k].floor_id_crash;
+        }
+      }
+    }
+
+    std::cout << "  " << config.population_size << " chromosomes:";
+    for (std::size_t i = 0; i < nb_workers.size(); ++i) {
+      std::cout << " " << nb_workers[i] << " -> " << sec[i] << "s (x"
+                << sec[0] / sec[i] << ")";
+    }
+    std::cout << std::endl;
+  }
+  std::cout << "  mismatches " << mismatches << std::endl << std::endl;
+}
+
+/************************************************************/
+void benchmarkIslands() {
+  constexpr int nb_runs{4};
+  constexpr int max_generations{1000};
+
+  // A single population, then islands on a ring, and on a random topology
+  const int nb_islands{std::max(
+      4, static_cast<int>(std::thread::hardware_concurrency()))};
+  GeneticConfig configs[3];
+  configs[1].nb_islands = nb_islands;
+  configs[2].nb_islands = nb_islands;
+  configs[2].migration_topology = Topology::Random;
+  const char *names[3]{"single", "ring", "random"};
+
+  const Levels levels;
+  std::cout << "Genetic search of every level, " << nb_runs
+            << " seeds, a single population then " << nb_islands
+            << " islands, landings within " << max_generations
+            << " generations, mean generations and time to the solution:"
+            << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    const Rocket rocket{levels.getRocket(level)};
+    const std::vector<int> floor{levels.getFloor(level)};
+    const LevelGeometry geometry(floor.data(), levels.getSizeFloor(level));
+
+    const DistanceField field(geometry);
+
+    std::cout << "  level " << level << ":";
+    for (int c = 0; c < 3; ++c) {
+      int nb_landings{0};
+      long long nb_generations{0};
+      double sec{0.};
+      for (int run = 0; run < nb_runs; ++run) {
+        Archipelago archipelago(rocket, geometry, &field, _RANDOM_SEED + run,
+                                configs[c], true, false);
+        bool landed{false};
+        sec += timeIt([&]() { landed = archipelago.run(max_generations); });
+        nb_landings += landed;
+        nb_generations += landed ? archipelago.generation : max_generations;
+      }
+      std::cout << " " << names[c] << " " << nb_landings << "/" << nb_runs
+                << " " << nb_generations / nb_runs << " gen " << sec / nb_runs
+                << "s" << (c < 2 ? "," : "");
+    }
+    std::cout << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+/************************************************************/
+//! @brief  Run the deterministic genetic search of a level: fly the
+//!         chromosomes with an `Evaluator`, then breed them, on the same
+//!         workers, until a landing.
+//!
+//! @param[in]  f_rocket       The initial rocket.
+//! @param[in]  f_geometry     Geometry of the level.
+//! @param[in]  f_floor_index  Floor index of the level.
+//! @param[in]  f_config       Dimensions and rates, deterministic.
+//! @param[in]  f_nb_workers   Number of workers.
+//! @param[in]  f_generations  Number of generations at most.
+//! @param[out] f_genes        Genes of the last population, one chromosome
+//!                            after the other.
+//! @param[out] f_landing      The landing, if any.
+//!
+//! @return The time of the generations, in s.
+double timeDeterministic(const Rocket &f_rocket,
+                         const LevelGeometry &f_geometry,
+                         const FloorIndex &f_floor_index,
+                         const GeneticConfig &f_config,
+                         const int f_nb_workers, const int f_generations,
+                         std::vector<Gene> &f_genes, Landing &f_landing) {
+  GeneticPopulation population(f_rocket, f_geometry, nullptr, _RANDOM_SEED,
+                               f_config);
+  ThreadPool pool(f_nb_workers);
+  Evaluator evaluator(f_floor_index, pool.size(), true, false);
+
+  // Until a landing
+  f_landing = Landing();
+  const double sec{timeIt([&]() {
+    for (int generation = 0; generation < f_generations; ++generation) {
+      f_landing = evaluator.evaluate(population, 0, &pool);
+      if (f_landing.chromosome != -1)
+        break;
+      population.mutate(0, &pool);
+    }
+  })};
+
+  f_genes.clear();
+  for (int chrom = 0; chrom < f_config.population_size; ++chrom) {
+    const GeneRow &genes{population.getChromosome(chrom)->chromosome};
+    f_genes.insert(f_genes.end(), genes.begin(), genes.end());
+  }
+  return sec;
+}
+
+/************************************************************/
+void benchmarkDeterminism() {
+  constexpr int generations{200};
+  constexpr int nb_workers[]{1, 4, 64};
+
+  GeneticConfig config;
+  config.population_size = 10 * _POPULATION_SIZE;
+  config.deterministic = true;
+  GeneticConfig islands_config;
+  islands_config.nb_islands = 4;
+  islands_config.deterministic = true;
+
+  const Levels levels;
+  std::cout << "Deterministic genetic search of every level, "
+            << generations << " generations, time of the generations of "
+            << config.population_size << " chromosomes with 1, 4 and 64 "
+            << "workers, and landings of " << islands_config.nb_islands
+            << " islands:" << std::endl;
+  int mismatches{0};
+  for (int level = 1; level <= 7; ++level) {
+    const Rocket rocket{levels.getRocket(level)};
+    const std::vector<int> floor{levels.getFloor(level)};
+    const LevelGeometry geometry(floor.data(), levels.getSizeFloor(level));
+    const FloorIndex floor_index(geometry);
+    const DistanceField field(geometry);
+
+    std::cout << "  level " << level << ":";
+    std::vector<Gene> expected;
+    std::vector<Gene> found;
+    Landing expected_landing;
+    Landing found_landing;
+    int island{-1};
+    int generation{0};
+    int fuel{0};
+    for (const int workers : nb_workers) {
+      const double sec{timeDeterministic(
+          rocket, geometry, floor_index, config, workers, generations,
+          workers == 1 ? expected : found,
+          workers == 1 ? expected_landing : found_landing)};
+      if (workers > 1) {
+        mismatches += found_landing.chromosome != expected_landing.chromosome ||
+                      found_landing.gene != expected_landing.gene ||
+                      found_landing.fuel != expected_landing.fuel;
+      }
+      for (std::size_t k = 0; workers > 1 && k < found.size(); ++k) {
+        mismatches += found[k].angle != expected[k].angle ||
+                      found[k].thrust != expected[k].thrust;
+      }
+
+      islands_config.nb_threads = workers;
+      Archipelago archipelago(rocket, geometry, &field, _RANDOM_SEED,
+                              islands_config, true, false);
+      archipelago.run(generations);
+      if (workers == 1) {
+        island = archipelago.island;
+        generation = archipelago.generation;
+        fuel = archipelago.fuel;
+      } else {
+        mismatches += archipelago.island != island ||
+                      archipelago.generation != generation ||
+                      archipelago.fuel != fuel;
+      }
+      std::cout << " " << workers << " -> " << sec << "s";
+    }
+    std::cout << ", chromosome " << expected_landing.chromosome
+              << ", island " << island << " generation " << generation
+              << std::endl;
+  }
+  std::cout << "  mismatches " << mismatches << std::endl << std::endl;
+}
+
+/************************************************************/
+void benchmarkRollingHorizon() {
+  constexpr int nb_turns{1000};
+  constexpr int chromosome_sizes[]{50, _CHROMOSOME_SIZE, 800};
+  constexpr int short_size{40};
+  constexpr int gene_generations{10};
+  constexpr int max_generations{4000};
+  constexpr int nb_seeds{2};
+
+  const Levels levels;
+  const std::vector<int> floor{levels.getFloor(1)};
+  const LevelGeometry geometry(floor.data(), levels.getSizeFloor(1));
+  std::cout << "Horizon moved on " << nb_turns << " turns, time per turn of "
+            << _POPULATION_SIZE << " chromosomes, the ring against every "
+            << "chromosome rotated:" << std::endl;
+  long long check{0};
+  for (const int chromosome_size : chromosome_sizes) {
+    GeneticConfig config;
+    config.chromosome_size = chromosome_size;
+    GeneticPopulation population(levels.getRocket(1), geometry, nullptr,
+                                 _RANDOM_SEED, config);
+    const double ring_sec{timeIt([&]() {
+      for (int turn = 0; turn < nb_turns; ++turn)
+        population.advance(turn);
+    })};
+    const double rotate_sec{timeIt([&]() {
+      for (int turn = 0; turn < nb_turns; ++turn) {
+        for (int i = 0; i < config.population_size; ++i) {
+          GeneRow &genes{population.getChromosome(i)->chromosome};
+          std::rotate(genes.begin(), genes.begin() + 1, genes.end());
+        }
+      }
+    })};
+    check += population.getChromosome(0)->getGene(nb_turns)->angle;
+    std::cout << "  " << chromosome_size << " genes: ring "
+              << 1e9 * ring_sec / nb_turns << "ns, rotated "
+              << 1e9 * rotate_sec / nb_turns << "ns" << std::endl;
+  }
+  std::cout << "  (check " << check << ")" << std::endl;
+
+  // A horizon shorter than the flights, moved on every `gene_generations`
+  GeneticConfig config;
+  config.chromosome_size = short_size;
+  config.deterministic = true;
+  config.gene_generations = gene_generations;
+  std::vector<Job> jobs;
+  for (int level = 1; level <= 7; ++level) {
+    for (int seed = 1; seed <= nb_seeds; ++seed)
+      jobs.push_back({level, static_cast<std::uint64_t>(seed)});
+  }
+  BatchSolver solver(config, 1., true, true, false, max_generations);
+  std::vector<JobResult> results;
+  solver.run(jobs, results);
+
+  std::cout << "Incremental search of every level with " << short_size
+            << " genes, a gene played every " << gene_generations
+            << " generations, " << nb_seeds
+            << " seeds: landings, and mean turns played:" << std::endl;
+  for (int level = 1; level <= 7; ++level) {
+    int solved{0};
+    double turns{0.};
+    for (int seed = 0; seed < nb_seeds; ++seed) {
+      const JobResult &result{results[(level - 1) * nb_seeds + seed]};
+      solved += result.solved;
+      turns += (result.generations - 1) / gene_generations;
+    }
+    std::cout << "  level " << level << ": " << solved << "/" << nb_seeds
+              << " " << turns / nb_seeds << " turns" << std::endl;
+  }
+  std::cout << std::endl;
+}
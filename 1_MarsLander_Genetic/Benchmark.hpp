@@ -0,0 +1,110 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+//! @brief  Run every benchmark and print the results on the command.
+void runBenchmarks();
+
+//! @brief  Time the per-step cost of the simulators, computing the
+//!         accelerations with sin and cos, then reading them from the compile
+//!         time table.
+void benchmarkPhysics();
+
+//! @brief  Fly the same random chromosomes on every level with each scalar
+//!         type, and compare to the `double` reference: maximum divergence of
+//!         the trajectories, and number of mismatching crash segments and
+//!         landing verdicts.
+void benchmarkPrecision();
+
+//! @brief  Check `FloorIndex` against the test of every floor segment on
+//!         random steps of every level, and time both. Then report the
+//!         fraction of the steps of random flights rejected by its clearance
+//!         envelope.
+void benchmarkCollision();
+
+//! @brief  Check the SIMD kernel of `FloorSegments` against `isIntersect` on
+//!         random segments, on a small integer grid to hit the collinear and
+//!         end point cases, and time both.
+void benchmarkSegmentKernel();
+
+//! @brief  Check the block-swept collisions against the step by step ones on
+//!         random trajectories of every level, and time both.
+void benchmarkSweptCollision();
+
+//! @brief  Time the build and the queries of the geodesic distance field of
+//!         every level, then count the generations the genetic search takes
+//!         to land from the initial rocket, scoring the crashes with the
+//!         distance along the floor, then with the geodesic distance.
+void benchmarkDistanceField();
+
+//! @brief  Time the selection policies of `GeneticPopulation::mutate` for
+//!         populations of 100 up to 100000 chromosomes, then check that the
+//!         roulette wheel ones draw as often as the fitness says.
+void benchmarkSelection();
+
+//! @brief  Time `rand`, then the bounded integers of `Random` one by one and
+//!         in bulk, then check that a seed always gives the same chromosomes.
+void benchmarkRandom();
+
+//! @brief  Time the crossover of a default population, the AVX2 lanes of
+//!         `crossoverGenes` against `crossoverGenesScalar`. The children
+//!         must be the same.
+void benchmarkCrossover();
+
+//! @brief  Read the genes of populations stored as a `GeneMatrix`, against
+//!         a vector per chromosome: count the cache lines of a chromosome,
+//!         and time the reads gene after gene of every chromosome, as the
+//!         batch mode, then chromosome after chromosome, as the crossover.
+void benchmarkGeneMatrix();
+
+//! @brief  Pack and unpack the genes of a population of 10000 chromosomes of
+//!         400 genes, with the lanes of `packGenes` and `unpackGenes`: the
+//!         memory of either layout, the time per gene, and the reads of the
+//!         genes unpacked on the fly. The genes must come back the same.
+void benchmarkPackedGenes();
+
+//! @brief  Time the generations of the default dimensions, against one gene
+//!         more, left over by the lanes of the crossover, then of a longer
+//!         horizon and of a larger population.
+void benchmarkConfig();
+
+//! @brief  Count the bytes moved, and time, by the ranking and the elitism of
+//!         one generation: the chromosomes sorted and copied by value, then
+//!         the elite slots ranked and carried on.
+void benchmarkRanking();
+
+//! @brief  Run the genetic search on every level, flying every chromosome,
+//!         then only the ones no longer evaluated, and time both. The
+//!         searches must be the same.
+void benchmarkEvaluationCache();
+
+//! @brief  Run the genetic search on every level, flying the chromosomes
+//!         through `PrefixTree`, and report the share of the steps read from
+//!         the tree generation after generation. Check the flights against
+//!         the rockets stepped all together, both by an `Evaluator`, and time
+//!         both.
+void benchmarkPrefixTree();
+
+//! @brief  Run the genetic search on every level, flying the chromosomes with
+//!         1 up to one worker per hardware thread, and time each. The
+//!         searches must be the same.
+void benchmarkThreads();
+
+//! @brief  Run the genetic search on every level with a single population,
+//!         then with islands migrating on a ring, and on a random topology,
+//!         and compare the landings and the time to the solution. The
+//!         crashes are scored with the geodesic distance.
+void benchmarkIslands();
+
+//! @brief  Run the deterministic genetic search on every level, a single
+//!         population bred on 1, 4 and 64 workers, then islands in lockstep
+//!         on as many workers, and time the generations. The populations
+//!         and the landings must be the same.
+void benchmarkDeterminism();
+
+//! @brief  Move the horizon of populations of 50 to 800 genes, the ring of
+//!         `GeneticPopulation::advance` against a rotation of every
+//!         chromosome, then run the incremental search of every level with
+//!         a horizon of 40 genes, shorter than the flights.
+void benchmarkRollingHorizon();
+
+#endif
@@ -0,0 +1,154 @@
+// Include standard headers
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "DistanceField.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+constexpr float _UNREACHED{std::numeric_limits<float>::infinity()};
+
+//! @brief  Check whether a point is inside a polygon, by the even-odd rule.
+//!
+//! @param[in] f_polygon  The vertices of the polygon.
+//! @param[in] x, y       Coordinates of the point.
+//!
+//! @return True if the point is inside.
+bool isInside(const std::vector<Coord_d> &f_polygon, const double x,
+              const double y) {
+  bool inside{false};
+  const int size{static_cast<int>(f_polygon.size())};
+  for (int k = 0, l = size - 1; k < size; l = k++) {
+    const Coord_d &p1{f_polygon[l]};
+    const Coord_d &p2{f_polygon[k]};
+    if ((p1.y > y) != (p2.y > y) &&
+        x < p1.x + (y - p1.y) * (p2.x - p1.x) / (p2.y - p1.y))
+      inside = !inside;
+  }
+  return inside;
+}
+
+/************************************************************/
+DistanceField::DistanceField(const LevelGeometry &f_geometry)
+    : landing_zone_id{f_geometry.landing_zone_id},
+      nb_cols{static_cast<int>(_w / _DISTANCE_FIELD_CELL) + 1},
+      nb_rows{static_cast<int>(_h / _DISTANCE_FIELD_CELL) + 1},
+      values(nb_cols * nb_rows, _UNREACHED), max_distance{0.} {
+  constexpr double h{_DISTANCE_FIELD_CELL};
+
+  // The ground: the floor, closed below the bottom of the map
+  std::vector<Coord_d> ground{f_geometry.points};
+  const double bottom{std::min(0., f_geometry.bounds.min_y) - h};
+  ground.push_back({ground.back().x, bottom});
+  ground.push_back({ground.front().x, bottom});
+
+  // The nodes in the ground are accepted from the start, never reached
+  std::vector<char> accepted(values.size(), 0);
+  for (int j = 0; j < nb_rows; ++j) {
+    for (int i = 0; i < nb_cols; ++i)
+      accepted[j * nb_cols + i] = isInside(ground, i * h, j * h);
+  }
+
+  // Sources: the lowest node of every column above the landing zone
+  typedef std::pair<double, int> Trial;
+  std::priority_queue<Trial, std::vector<Trial>, std::greater<Trial>> trials;
+  if (landing_zone_id != -1) {
+    const Line_d &lz{f_geometry.segments[landing_zone_id]};
+    const double lz_min_x{std::min(lz.p1.x, lz.p2.x)};
+    const double lz_max_x{std::max(lz.p1.x, lz.p2.x)};
+    const int j{std::min(nb_rows - 1,
+                         static_cast<int>(std::ceil(lz.p1.y / h)))};
+    const int i_min{std::max(0, static_cast<int>(std::ceil(lz_min_x / h)))};
+    const int i_max{
+        std::min(nb_cols - 1, static_cast<int>(std::floor(lz_max_x / h)))};
+    for (int i = i_min; i <= i_max; ++i) {
+      const int n{j * nb_cols + i};
+      accepted[n] = 0;
+      values[n] = static_cast<float>(j * h - lz.p1.y);
+      trials.push({values[n], n});
+    }
+  }
+
+  // Fast marching: accept the closest trial node, update its neighbours
+  const auto known = [&](const int i, const int j) {
+    if (i < 0 || i >= nb_cols || j < 0 || j >= nb_rows)
+      return std::numeric_limits<double>::infinity();
+    const int n{j * nb_cols + i};
+    return accepted[n] ? static_cast<double>(values[n])
+                       : std::numeric_limits<double>::infinity();
+  };
+  while (!trials.empty()) {
+    const Trial trial{trials.top()};
+    trials.pop();
+    const int n{trial.second};
+    if (accepted[n] || trial.first > values[n])
+      continue;
+    accepted[n] = 1;
+    max_distance = std::max(max_distance, trial.first);
+
+    const int i0{n % nb_cols};
+    const int j0{n / nb_cols};
+    const int neighbours[4][2]{
+        {i0 - 1, j0}, {i0 + 1, j0}, {i0, j0 - 1}, {i0, j0 + 1}};
+    for (const auto &neighbour : neighbours) {
+      const int i{neighbour[0]};
+      const int j{neighbour[1]};
+      if (i < 0 || i >= nb_cols || j < 0 || j >= nb_rows ||
+          accepted[j * nb_cols + i])
+        continue;
+
+      // First order upwind solution of |grad T| = 1
+      const double a{std::min(known(i - 1, j), known(i + 1, j))};
+      const double b{std::min(known(i, j - 1), known(i, j + 1))};
+      double t;
+      if (std::abs(a - b) >= h) {
+        t = std::min(a, b) + h;
+      } else {
+        t = 0.5 * (a + b + std::sqrt(2. * h * h - (a - b) * (a - b)));
+      }
+
+      const int m{j * nb_cols + i};
+      if (t < values[m]) {
+        values[m] = static_cast<float>(t);
+        trials.push({values[m], m});
+      }
+    }
+  }
+}
+
+/************************************************************/
+double DistanceField::bestThrough(const double x, const double y,
+                                  const int f_i, const int f_j,
+                                  const int f_nodes) const {
+  double best{std::numeric_limits<double>::infinity()};
+  for (int j = std::max(0, f_j); j < std::min(nb_rows, f_j + f_nodes); ++j) {
+    for (int i = std::max(0, f_i); i < std::min(nb_cols, f_i + f_nodes); ++i) {
+      const float value{values[j * nb_cols + i]};
+      if (value == _UNREACHED)
+        continue;
+      const double dx{x - i * _DISTANCE_FIELD_CELL};
+      const double dy{y - j * _DISTANCE_FIELD_CELL};
+      best = std::min(best, value + std::sqrt(dx * dx + dy * dy));
+    }
+  }
+  return best;
+}
+
+/************************************************************/
+double DistanceField::at(const double x, const double y) const {
+  const double cx{std::min(std::max(x, 0.), static_cast<double>(_w))};
+  const double cy{std::min(std::max(y, 0.), static_cast<double>(_h))};
+  const int i{static_cast<int>(cx / _DISTANCE_FIELD_CELL)};
+  const int j{static_cast<int>(cy / _DISTANCE_FIELD_CELL)};
+
+  double best{bestThrough(cx, cy, i, j, 2)};
+  if (best == std::numeric_limits<double>::infinity())
+    best = bestThrough(cx, cy, i - 2, j - 2, 6);
+  return best == std::numeric_limits<double>::infinity() ? max_distance
+                                                         : best;
+}
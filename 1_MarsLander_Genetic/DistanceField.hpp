@@ -0,0 +1,61 @@
+#ifndef DISTANCE_FIELD_HPP
+#define DISTANCE_FIELD_HPP
+
+#include <vector>
+
+#include "LevelGeometry.hpp"
+
+constexpr double _DISTANCE_FIELD_CELL{25.}; //!< Grid spacing, in m.
+
+//! @brief  Geodesic distance to the landing zone, through the air, from any
+//!         point of the map.
+//!
+//! Computed once per level by fast marching on a uniform grid: the nodes
+//! inside the ground, i.e., inside the polygon closed by the floor and the
+//! bottom of the map, are obstacles, the nodes right above the landing zone
+//! are the sources, and the first order eikonal update spreads the distance
+//! around the walls and the overhangs of the caves. The nodes the march never
+//! reaches keep an infinite distance.
+//!
+//! Walls thinner than a cell could leak, none of the seven levels has one.
+class DistanceField {
+public:
+  //! @brief  C'tor. Runs the fast marching.
+  //!
+  //! @param[in] f_geometry  Geometry of the level.
+  DistanceField(const LevelGeometry &f_geometry);
+
+  //! @brief  Get the geodesic distance from a point to the landing zone, in
+  //!         O(1).
+  //!
+  //! The smallest distance of the reached corners of the cell holding the
+  //! point, plus the straight leg to that corner. When the point is in the
+  //! ground with no reached corner, the ring of cells around is searched,
+  //! then the farthest distance of the field is returned.
+  //!
+  //! @param[in] x, y  Coordinates of the point, clamped to the map.
+  //!
+  //! @return The distance.
+  double at(const double x, const double y) const;
+
+  int landing_zone_id; //!< ID of the landing zone among the floor segments.
+
+  int nb_cols;               //!< Number of nodes along x.
+  int nb_rows;               //!< Number of nodes along y.
+  std::vector<float> values; //!< Distances at the nodes, row after row.
+  double max_distance;       //!< Farthest reached distance.
+
+private:
+  //! @brief  Get the smallest distance through the reached nodes of a square
+  //!         of nodes.
+  //!
+  //! @param[in] x, y       Coordinates of the point.
+  //! @param[in] f_i, f_j   Column and row of the bottom left node.
+  //! @param[in] f_nodes    Side of the square, in nodes.
+  //!
+  //! @return The distance, infinite if no node is reached.
+  double bestThrough(const double x, const double y, const int f_i,
+                     const int f_j, const int f_nodes) const;
+};
+
+#endif
@@ -0,0 +1,248 @@
+// Include standard headers
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <limits>
+
+#include "Evaluator.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+/************************************************************/
+void Evaluator::Scratch::land(const int f_chrom, const int f_gene,
+                              const int f_fuel, std::atomic<int> &f_first) {
+  if (landing.chromosome == -1 || f_chrom < landing.chromosome)
+    landing = {f_chrom, f_gene, f_fuel};
+  int first{f_first};
+  while (f_chrom < first && !f_first.compare_exchange_weak(first, f_chrom))
+    ;
+}
+
+/************************************************************/
+Evaluator::Evaluator(const FloorIndex &f_floor_index, const int f_nb_workers,
+                     const bool f_swept, const bool f_shared,
+                     const bool f_cached)
+    : nb_chromosomes{0}, nb_flown{0}, floor_index(f_floor_index),
+      swept{f_swept}, shared{f_shared}, cached{f_cached},
+      first_landed{std::numeric_limits<int>::max()} {
+  for (int w = 0; w < std::max(1, f_nb_workers); ++w)
+    scratches.emplace_back(new Scratch(floor_index));
+}
+
+/************************************************************/
+Landing Evaluator::evaluate(GeneticPopulation &f_population,
+                            const int f_idxStart, ThreadPool *f_pool,
+                            RocketLines *f_lines) {
+  const int population_size{f_population.config.population_size};
+  const int nb_workers{f_pool ? f_pool->size() : 1};
+  assert(nb_workers <= static_cast<int>(scratches.size()));
+
+  // The chromosomes still evaluated keep their rockets, unless their lines
+  // are drawn or not cached
+  to_fly.clear();
+  for (int chrom = 0; chrom < population_size; ++chrom) {
+    if (f_lines || !cached || !f_population.isEvaluated(chrom, f_idxStart))
+      to_fly.push_back(chrom);
+  }
+  nb_chromosomes += population_size;
+  nb_flown += to_fly.size();
+
+  // Chunks of `_BATCH_SIZE` chromosomes, smaller when shared by several
+  // workers
+  const int nbToFly{static_cast<int>(to_fly.size())};
+  int chunk{_BATCH_SIZE};
+  if (nb_workers > 1) {
+    const int nbTasks{_TASKS_PER_WORKER * nb_workers};
+    chunk = (nbToFly + nbTasks - 1) / nbTasks;
+    chunk = std::min(_BATCH_SIZE, std::max(_BATCH_LANES,
+                                           (chunk + _BATCH_LANES - 1) /
+                                               _BATCH_LANES * _BATCH_LANES));
+  }
+  const bool prefixes{shared && !f_lines};
+  for (const std::unique_ptr<Scratch> &scratch : scratches) {
+    scratch->landing = Landing();
+    if (prefixes)
+      scratch->prefix_tree.reset(f_population.rocket_save, f_idxStart);
+  }
+  first_landed = std::numeric_limits<int>::max();
+
+  const std::function<void(int, int)> task{[&](const int f_task,
+                                               const int f_worker) {
+    Scratch &scratch{*scratches[f_worker]};
+    const int first{f_task * chunk};
+    const int count{std::min(chunk, nbToFly - first)};
+    const int *ids{&to_fly[first]};
+
+    if (prefixes)
+      flyShared(scratch, f_population, ids, count, f_idxStart);
+    else if (swept)
+      flySwept(scratch, f_population, ids, count, f_idxStart, f_lines);
+    else
+      flyBatch(scratch, f_population, ids, count, f_idxStart, f_lines);
+  }};
+  const int nbChunks{(nbToFly + chunk - 1) / chunk};
+  if (f_pool) {
+    f_pool->run(nbChunks, task);
+  } else {
+    for (int t = 0; t < nbChunks; ++t)
+      task(t, 0);
+  }
+
+  // The landing of the first chromosome, whichever worker flew it
+  Landing landing;
+  for (const std::unique_ptr<Scratch> &scratch : scratches) {
+    if (scratch->landing.chromosome != -1 &&
+        (landing.chromosome == -1 ||
+         scratch->landing.chromosome < landing.chromosome))
+      landing = scratch->landing;
+  }
+  return landing;
+}
+
+/************************************************************/
+EvaluationCounters Evaluator::getCounters() const {
+  EvaluationCounters counters;
+  for (const std::unique_ptr<Scratch> &scratch : scratches) {
+    counters.nb_steps += scratch->nbSteps;
+    counters.nb_checked_steps += scratch->nbCheckedSteps;
+    counters.nb_prefix_steps += scratch->prefix_tree.nb_steps;
+    counters.nb_shared_steps += scratch->prefix_tree.nb_shared_steps;
+    counters.floor_counters += scratch->floor_counters;
+    counters.floor_counters += scratch->prefix_tree.floor_counters;
+  }
+  return counters;
+}
+
+/************************************************************/
+void Evaluator::flyShared(Scratch &f_scratch, GeneticPopulation &f_population,
+                          const int *f_ids, const int f_count,
+                          const int f_idxStart) {
+  // Chromosome after chromosome, following the known prefixes
+  for (int i = 0; i < f_count && f_ids[i] < first_landed; ++i) {
+    const int chrom{f_ids[i]};
+    Rocket *rocket_chrom{f_population.getRocket(chrom)};
+    const Collision collision{f_scratch.prefix_tree.fly(
+        *f_population.getChromosome(chrom), *rocket_chrom)};
+    rocket_chrom->isAlive = collision.step == -1;
+    rocket_chrom->floor_id_crash = collision.floorId;
+
+    // Landing successful!
+    if (collision.floorId != -1 &&
+        collision.floorId == f_population.landing_zone_id &&
+        rocket_chrom->isParamSuccess()) {
+      f_scratch.land(chrom, f_idxStart + collision.step - 1,
+                     rocket_chrom->fuel, first_landed);
+    }
+  }
+}
+
+/************************************************************/
+void Evaluator::flySwept(Scratch &f_scratch, GeneticPopulation &f_population,
+                         const int *f_ids, const int f_count,
+                         const int f_idxStart, RocketLines *f_lines) {
+  // Chromosome after chromosome, collisions block of steps after block
+  Trajectory &trajectory{f_scratch.trajectory};
+  for (int i = 0; i < f_count && f_ids[i] < first_landed; ++i) {
+    const int chrom{f_ids[i]};
+    StepEngine::simulate(f_population.rocket_save,
+                         *f_population.getChromosome(chrom), f_idxStart,
+                         trajectory);
+    const Collision collision{sweptCollision(trajectory, floor_index,
+                                             f_scratch.nbCheckedSteps,
+                                             &f_scratch.floor_counters)};
+    f_scratch.nbSteps += trajectory.size;
+
+    const int last{collision.step == -1 ? trajectory.size : collision.step};
+    Rocket *rocket_chrom{f_population.getRocket(chrom)};
+    trajectory.getRocket(last, *rocket_chrom);
+    rocket_chrom->isAlive = collision.step == -1;
+    rocket_chrom->floor_id_crash = collision.floorId;
+
+    // Landing successful!
+    if (collision.floorId != -1 &&
+        collision.floorId == f_population.landing_zone_id &&
+        rocket_chrom->isParamSuccess()) {
+      f_scratch.land(chrom, f_idxStart + collision.step - 1,
+                     rocket_chrom->fuel, first_landed);
+    }
+    if (!f_lines)
+      continue;
+
+    // A dead Rocket stays where it is until the end of the chromosome
+    for (int k = 1; k <= last; ++k)
+      f_lines->updateRocketLine(trajectory.x[k], trajectory.y[k], k - 1, chrom);
+    if (!rocket_chrom->isAlive) {
+      f_lines->fillRocketLine(trajectory.x[last], trajectory.y[last], last - 1,
+                              chrom);
+    }
+  }
+}
+
+/************************************************************/
+void Evaluator::flyBatch(Scratch &f_scratch, GeneticPopulation &f_population,
+                         const int *f_ids, const int f_count,
+                         const int f_idxStart, RocketLines *f_lines) {
+  // The rockets of the chunk, stepped all together
+  RocketBatch &rockets{*f_scratch.rockets};
+  rockets.init(f_population.rocket_save, f_ids, f_count);
+
+  // For every possible moves, i.e., for every genes of the horizon, until
+  // every Rocket of the chunk is dead
+  const int idxEnd{f_idxStart + f_population.config.chromosome_size};
+  for (int gen = f_idxStart;
+       gen < idxEnd && rockets.count > 0 && f_ids[0] < first_landed; ++gen) {
+    // Step every alive Rocket of the chunk at once
+    for (int slot = 0; slot < rockets.count; ++slot) {
+      const Gene *gene{
+          f_population.getChromosome(rockets.ids[slot])->getGene(gen)};
+      f_scratch.angles[slot] = gene->angle;
+      f_scratch.thrusts[slot] = gene->thrust;
+    }
+    rockets.updateRockets(f_scratch.angles, f_scratch.thrusts);
+
+    // For every alive Rocket and their associated chromosome
+    for (int slot = 0; slot < rockets.count; ++slot) {
+      const int chrom{rockets.ids[slot]};
+      const Line_d prev_curr{{rockets.pX[slot], rockets.pY[slot]},
+                             {rockets.x[slot], rockets.y[slot]}};
+      if (rockets.x[slot] < 0 || rockets.x[slot] > _w ||
+          rockets.y[slot] < 0 || rockets.y[slot] > _h) {
+        rockets.kill(slot, -1);
+      } else {
+        const int k{floor_index.firstIntersection(
+            prev_curr, &f_scratch.floor_counters)};
+        if (k != -1) {
+          rockets.kill(slot, k);
+
+          // Landing successful!
+          if (k == f_population.landing_zone_id &&
+              rockets.isParamSuccess(slot)) {
+            f_scratch.land(chrom, gen, rockets.fuel[slot], first_landed);
+          }
+        }
+      }
+
+      // A dead Rocket stays where it is until the end of the chromosome
+      if (!f_lines)
+        continue;
+      if (rockets.isAlive[slot]) {
+        f_lines->updateRocketLine(rockets.x[slot], rockets.y[slot],
+                                  gen - f_idxStart, chrom);
+      } else {
+        f_lines->fillRocketLine(rockets.x[slot], rockets.y[slot],
+                                gen - f_idxStart, chrom);
+      }
+    }
+
+    // Keep the alive Rockets packed in the lanes
+    if ((gen - f_idxStart + 1) % _REORDER_PERIOD == 0) {
+      rockets.reorder();
+    } else {
+      rockets.compact();
+    }
+  }
+
+  for (int slot = 0; slot < f_count; ++slot)
+    rockets.getRocket(slot, *f_population.getRocket(rockets.ids[slot]));
+}
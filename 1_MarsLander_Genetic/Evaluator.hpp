@@ -0,0 +1,172 @@
+#ifndef EVALUATOR_HPP
+#define EVALUATOR_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "FloorIndex.hpp"
+#include "Genetic.hpp"
+#include "PrefixTree.hpp"
+#include "RocketBatch.hpp"
+#include "ThreadPool.hpp"
+#include "Trajectory.hpp"
+
+constexpr int _TASKS_PER_WORKER{4}; //!< Chunks of chromosomes per worker and
+                                    //!< generation, left to steal.
+
+//! @brief  Landing found by the evaluation of a generation.
+struct Landing {
+  int chromosome{-1}; //!< Index of the chromosome, -1 if none.
+  int gene{-1};       //!< Index of the gene of the touchdown.
+  int fuel{0};        //!< Fuel left.
+};
+
+//! @brief  Steps counted by the workers of an `Evaluator`.
+struct EvaluationCounters {
+  long long nb_steps{0};         //!< Swept mode: steps flown.
+  long long nb_checked_steps{0}; //!< Swept mode: steps checked one by one.
+  long long nb_prefix_steps{0};  //!< Shared mode: steps to the outcomes.
+  long long nb_shared_steps{0};  //!< Shared mode: steps read from the tree.
+  FloorCounters floor_counters;  //!< Steps of the floor index.
+};
+
+//! @brief  Receiver of the lines of the rockets flown: the display.
+class RocketLines {
+public:
+  virtual ~RocketLines() = default;
+
+  //! @brief  Update the line of one rocket among the whole population.
+  //!
+  //! @param[in] f_x, f_y  The current rocket coordinates.
+  //! @param[in] f_gen     Its gene index within the horizon.
+  //! @param[in] f_chrom   Its chromosome index within the population.
+  virtual void updateRocketLine(const double f_x, const double f_y,
+                                const int f_gen, const int f_chrom) = 0;
+
+  //! @brief  Fill the line of one dead rocket, from its death to the end of
+  //!         its chromosome, with its last coordinates.
+  virtual void fillRocketLine(const double f_x, const double f_y,
+                              const int f_gen, const int f_chrom) = 0;
+};
+
+//! @brief  Flight of the chromosomes of a generation, and its first landing.
+//!
+//! The one evaluation of `solve`, of the islands of `Archipelago` and of the
+//! jobs of `BatchSolver`. The chromosomes no longer evaluated are cut in
+//! chunks, flown by the workers of a pool:
+//!     - shared mode: chromosome after chromosome, along a `PrefixTree`,
+//!     - swept mode: chromosome after chromosome, the collisions block of
+//!       steps after block,
+//!     - else: the rockets of a chunk stepped all together, on the lanes of a
+//!       `RocketBatch`.
+//! The workers skip the chromosomes after the first one landed: the same one
+//! lands whatever the workers and their chunks.
+class Evaluator {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_floor_index  The floor of the level, shared by the workers.
+  //! @param[in] f_nb_workers   Workers of the pools of `evaluate` at most.
+  //! @param[in] f_swept        Swept collisions.
+  //! @param[in] f_shared       Chromosomes flown along their shared prefixes.
+  //! @param[in] f_cached       Chromosomes still evaluated not flown again.
+  //!                           Default is true, as `solve`.
+  Evaluator(const FloorIndex &f_floor_index, const int f_nb_workers,
+            const bool f_swept, const bool f_shared,
+            const bool f_cached = true);
+
+  Evaluator(const Evaluator &) = delete;
+  Evaluator &operator=(const Evaluator &) = delete;
+
+  //! @brief  Fly the chromosomes of a generation, and find the first one
+  //!         landed.
+  //!
+  //! @param[in,out] f_population  The population: its rockets are updated.
+  //! @param[in]     f_idxStart    Incremental index of the evaluations.
+  //! @param[in]     f_pool        The workers. Default is nullptr, the
+  //!                              calling thread only.
+  //! @param[in]     f_lines       Lines of the rockets, drawn. Default is
+  //!                              nullptr, none: then the chromosomes still
+  //!                              evaluated are not flown again if cached,
+  //!                              and the shared mode applies.
+  //!
+  //! @return The landing of the first chromosome landed, if any.
+  Landing evaluate(GeneticPopulation &f_population, const int f_idxStart,
+                   ThreadPool *f_pool = nullptr,
+                   RocketLines *f_lines = nullptr);
+
+  //! @brief  Get the steps counted by the workers, since the c'tor.
+  //!
+  //! @return The sums of the workers.
+  EvaluationCounters getCounters() const;
+
+  long long nb_chromosomes; //!< Chromosomes of the generations evaluated.
+  long long nb_flown;       //!< Chromosomes flown among them.
+
+private:
+  //! @brief  Scratch of a worker: nothing of it is shared with the others.
+  struct Scratch {
+    //! @brief  C'tor.
+    //!
+    //! @param[in] f_floor_index  The floor of the level.
+    explicit Scratch(const FloorIndex &f_floor_index)
+        : prefix_tree(f_floor_index), rockets{new RocketBatch} {}
+
+    //! @brief  Keep a landing, if of the first chromosome landed by the
+    //!         worker, and lower the first chromosome landed by any worker.
+    //!
+    //! @param[in]     f_chrom  Index of the chromosome.
+    //! @param[in]     f_gene   Index of the gene of the touchdown.
+    //! @param[in]     f_fuel   Fuel left.
+    //! @param[in,out] f_first  First chromosome landed by any worker.
+    void land(const int f_chrom, const int f_gene, const int f_fuel,
+              std::atomic<int> &f_first);
+
+    FloorCounters floor_counters; //!< Steps of the floor index.
+    PrefixTree prefix_tree;       //!< Shared mode: prefixes flown.
+    Trajectory trajectory;        //!< Swept mode: trajectory of a chromosome.
+    long long nbSteps{0};         //!< Swept mode: steps flown.
+    long long nbCheckedSteps{0};  //!< Swept mode: steps checked one by one.
+
+    std::unique_ptr<RocketBatch> rockets; //!< Rockets of a chunk.
+    std::int8_t angles[_BATCH_SIZE]{};    //!< Angle requests of the chunk.
+    std::int8_t thrusts[_BATCH_SIZE]{};   //!< Thrust requests of the chunk.
+
+    Landing landing; //!< First landing found by the worker.
+  };
+
+  //! @brief  Fly a chunk along the prefix tree of the worker.
+  //!
+  //! @param[in,out] f_scratch     Scratch of the worker.
+  //! @param[in,out] f_population  The population.
+  //! @param[in]     f_ids         Chromosomes of the chunk.
+  //! @param[in]     f_count       Their number.
+  //! @param[in]     f_idxStart    Incremental index of the evaluations.
+  void flyShared(Scratch &f_scratch, GeneticPopulation &f_population,
+                 const int *f_ids, const int f_count, const int f_idxStart);
+
+  //! @brief  Same as `flyShared`, with the swept collisions.
+  //!
+  //! @param[in] f_lines  Lines of the rockets, nullptr for none.
+  void flySwept(Scratch &f_scratch, GeneticPopulation &f_population,
+                const int *f_ids, const int f_count, const int f_idxStart,
+                RocketLines *f_lines);
+
+  //! @brief  Same as `flySwept`, the rockets of the chunk all together.
+  void flyBatch(Scratch &f_scratch, GeneticPopulation &f_population,
+                const int *f_ids, const int f_count, const int f_idxStart,
+                RocketLines *f_lines);
+
+  const FloorIndex &floor_index; //!< The floor of the level.
+  const bool swept;              //!< Swept collisions.
+  const bool shared;             //!< Shared prefixes.
+  const bool cached;             //!< Chromosomes still evaluated skipped.
+
+  std::vector<std::unique_ptr<Scratch>> scratches; //!< One per worker.
+  std::vector<int> to_fly;       //!< Chromosomes of the generation to fly.
+  std::atomic<int> first_landed; //!< First chromosome landed, by any worker.
+};
+
+#endif
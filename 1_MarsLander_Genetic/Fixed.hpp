@@ -0,0 +1,118 @@
+#ifndef FIXED_HPP
+#define FIXED_HPP
+
+#include <cstdint>
+
+//! @brief  Signed fixed-point number, 16 fractional bits on a 64 bits integer.
+//!
+//! Every operation is integer arithmetic: the results are the same on every
+//! machine and compiler. The range fits the simulation: coordinates up to the
+//! map size, products of two coordinates, and squared speeds.
+class Fixed {
+public:
+  static constexpr int FRACTION_BITS{16}; //!< Number of fractional bits.
+  static constexpr std::int64_t ONE{std::int64_t{1}
+                                    << FRACTION_BITS}; //!< Raw value of 1.
+
+  //! @brief  C'tors.
+  constexpr Fixed() : raw{0} {}
+  constexpr Fixed(const int f_value)
+      : raw{static_cast<std::int64_t>(f_value) * ONE} {}
+  constexpr Fixed(const double f_value)
+      : raw{static_cast<std::int64_t>(f_value * ONE +
+                                      (f_value < 0 ? -0.5 : 0.5))} {}
+
+  //! @brief  Build a fixed-point number from its raw value.
+  //!
+  //! @param[in] f_raw  The raw value.
+  //!
+  //! @return The number.
+  static constexpr Fixed fromRaw(const std::int64_t f_raw) {
+    Fixed res;
+    res.raw = f_raw;
+    return res;
+  }
+
+  //! @brief  Conversions.
+  explicit constexpr operator double() const {
+    return static_cast<double>(raw) / ONE;
+  }
+  explicit constexpr operator int() const {
+    return static_cast<int>(raw / ONE);
+  }
+
+  Fixed &operator+=(const Fixed f_other) {
+    raw += f_other.raw;
+    return *this;
+  }
+  Fixed &operator-=(const Fixed f_other) {
+    raw -= f_other.raw;
+    return *this;
+  }
+  Fixed &operator*=(const Fixed f_other) {
+    raw = (raw * f_other.raw) >> FRACTION_BITS;
+    return *this;
+  }
+  Fixed &operator/=(const Fixed f_other) {
+    raw = (raw * ONE) / f_other.raw;
+    return *this;
+  }
+
+  friend constexpr Fixed operator-(const Fixed a) { return fromRaw(-a.raw); }
+  friend Fixed operator+(Fixed a, const Fixed b) { return a += b; }
+  friend Fixed operator-(Fixed a, const Fixed b) { return a -= b; }
+  friend Fixed operator*(Fixed a, const Fixed b) { return a *= b; }
+  friend Fixed operator/(Fixed a, const Fixed b) { return a /= b; }
+
+  friend constexpr bool operator==(const Fixed a, const Fixed b) {
+    return a.raw == b.raw;
+  }
+  friend constexpr bool operator!=(const Fixed a, const Fixed b) {
+    return a.raw != b.raw;
+  }
+  friend constexpr bool operator<(const Fixed a, const Fixed b) {
+    return a.raw < b.raw;
+  }
+  friend constexpr bool operator>(const Fixed a, const Fixed b) {
+    return a.raw > b.raw;
+  }
+  friend constexpr bool operator<=(const Fixed a, const Fixed b) {
+    return a.raw <= b.raw;
+  }
+  friend constexpr bool operator>=(const Fixed a, const Fixed b) {
+    return a.raw >= b.raw;
+  }
+
+  //! @brief  Absolute value.
+  friend constexpr Fixed abs(const Fixed a) {
+    return fromRaw(a.raw < 0 ? -a.raw : a.raw);
+  }
+
+  //! @brief  Square root, rounded down, computed on integers only.
+  friend Fixed sqrt(const Fixed a) {
+    if (a.raw <= 0)
+      return Fixed{};
+
+    // sqrt(raw / ONE) * ONE = sqrt(raw * ONE)
+    const std::uint64_t n{static_cast<std::uint64_t>(a.raw) << FRACTION_BITS};
+    std::uint64_t res{0};
+    std::uint64_t bit{std::uint64_t{1} << 62};
+    while (bit > n)
+      bit >>= 2;
+    std::uint64_t rem{n};
+    while (bit != 0) {
+      if (rem >= res + bit) {
+        rem -= res + bit;
+        res = (res >> 1) + bit;
+      } else {
+        res >>= 1;
+      }
+      bit >>= 2;
+    }
+    return fromRaw(static_cast<std::int64_t>(res));
+  }
+
+  std::int64_t raw; //!< Raw value: the number times `ONE`.
+};
+
+#endif
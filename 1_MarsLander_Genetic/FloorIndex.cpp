@@ -0,0 +1,109 @@
+// Include standard headers
+#include <algorithm>
+#include <limits>
+
+#include "FloorIndex.hpp"
+
+extern const float _w; //!< Map width.
+
+/************************************************************/
+FloorIndex::FloorIndex(const LevelGeometry &f_geometry)
+    : nb_buckets{static_cast<int>(_w / _FLOOR_BUCKET_WIDTH) + 1},
+      bucket_start(nb_buckets + 1, 0),
+      bucket_max_y(nb_buckets, std::numeric_limits<double>::lowest()),
+      max_height{f_geometry.bounds.max_y} {
+  const int size_floor{f_geometry.size_floor};
+  const std::vector<Box> &boxes{f_geometry.boxes};
+
+  // Counting sort of the segments into the buckets: the IDs stay increasing
+  for (int k = 1; k < size_floor; ++k) {
+    for (int b = bucket(boxes[k].min_x); b <= bucket(boxes[k].max_x); ++b) {
+      ++bucket_start[b + 1];
+      bucket_max_y[b] = std::max(bucket_max_y[b], boxes[k].max_y);
+    }
+  }
+  for (int b = 0; b < nb_buckets; ++b)
+    bucket_start[b + 1] += bucket_start[b];
+
+  bucket_ids.resize(bucket_start[nb_buckets]);
+  std::vector<int> fill(bucket_start.begin(), bucket_start.end() - 1);
+  for (int k = 1; k < size_floor; ++k) {
+    for (int b = bucket(boxes[k].min_x); b <= bucket(boxes[k].max_x); ++b)
+      bucket_ids[fill[b]++] = k;
+  }
+  for (const int k : bucket_ids)
+    bucket_segments.push(f_geometry.segments[k]);
+}
+
+/************************************************************/
+int FloorIndex::bucket(const double x) const {
+  return std::min(nb_buckets - 1,
+                  std::max(0, static_cast<int>(x / _FLOOR_BUCKET_WIDTH)));
+}
+
+/************************************************************/
+int FloorIndex::firstIntersection(const Line_d &f_step,
+                                  FloorCounters *f_counters) const {
+  const double step_min_x{std::min(f_step.p1.x, f_step.p2.x)};
+  const double step_max_x{std::max(f_step.p1.x, f_step.p2.x)};
+  const double step_min_y{std::min(f_step.p1.y, f_step.p2.y)};
+  const int first_bucket{bucket(step_min_x)};
+  const int last_bucket{bucket(step_max_x)};
+
+  // Clearance envelope: nothing to test when the step is above every segment
+  if (f_counters)
+    ++f_counters->nb_steps;
+  bool above{true};
+  if (step_min_y <= max_height) {
+    for (int b = first_bucket; above && b <= last_bucket; ++b)
+      above = step_min_y > bucket_max_y[b];
+  }
+  if (above) {
+    if (f_counters)
+      ++f_counters->nb_rejected;
+    return -1;
+  }
+
+  // A segment may be listed in several buckets: keep the smallest hit
+  int first{-1};
+  for (int b = first_bucket; b <= last_bucket; ++b) {
+    if (step_min_y > bucket_max_y[b])
+      continue;
+    const int i{bucket_segments.firstIntersection(f_step, bucket_start[b],
+                                                  bucket_start[b + 1])};
+    if (i != -1 && (first == -1 || bucket_ids[i] < first))
+      first = bucket_ids[i];
+  }
+  return first;
+}
+
+/************************************************************/
+bool FloorIndex::mayTouch(const double f_min_x, const double f_max_x,
+                          const double f_min_y, const double f_max_y) const {
+  if (f_min_y > max_height)
+    return false;
+
+  const FloorSegments &s{bucket_segments};
+  for (int b = bucket(f_min_x); b <= bucket(f_max_x); ++b) {
+    if (f_min_y > bucket_max_y[b])
+      continue;
+    for (int i = bucket_start[b]; i < bucket_start[b + 1]; ++i) {
+      if (s.max_x[i] >= f_min_x && s.min_x[i] <= f_max_x &&
+          s.max_y[i] >= f_min_y && s.min_y[i] <= f_max_y)
+        return true;
+    }
+  }
+  return false;
+}
+
+/************************************************************/
+double FloorCounters::getRejectionRate() const {
+  return nb_steps == 0 ? 0. : static_cast<double>(nb_rejected) / nb_steps;
+}
+
+/************************************************************/
+FloorCounters &FloorCounters::operator+=(const FloorCounters &f_other) {
+  nb_steps += f_other.nb_steps;
+  nb_rejected += f_other.nb_rejected;
+  return *this;
+}
@@ -0,0 +1,102 @@
+#ifndef FLOOR_INDEX_HPP
+#define FLOOR_INDEX_HPP
+
+#include <vector>
+
+#include "FloorSegments.hpp"
+#include "LevelGeometry.hpp"
+#include "Utils.hpp"
+
+constexpr double _FLOOR_BUCKET_WIDTH{250.}; //!< Width of the x-buckets, in m.
+
+//! @brief  Step counters of the clearance envelope of `FloorIndex`, kept by
+//!         its callers: one per thread, the index itself shared read-only.
+struct FloorCounters {
+  long long nb_steps{0};    //!< Number of steps checked.
+  long long nb_rejected{0}; //!< Steps rejected by the envelope.
+
+  //! @brief  Get the fraction of the steps rejected by the clearance
+  //!         envelope.
+  //!
+  //! @return The fraction, in [0, 1].
+  double getRejectionRate() const;
+
+  //! @brief  Add the counters of another thread.
+  //!
+  //! @param[in] f_other  The counters.
+  //!
+  //! @return These counters.
+  FloorCounters &operator+=(const FloorCounters &f_other);
+};
+
+//! @brief  Spatial index over the floor segments of a level.
+//!
+//! The map is cut in uniform x-buckets. Each bucket lists, in increasing
+//! order, the IDs of the segments whose x-range overlaps it. The segments are
+//! registered by their x-range only, so the overhanging caves of levels 6 and
+//! 7, where x is not monotonic along the floor, need nothing special.
+//! A step only tests the segments of the buckets covered by its x-range, with
+//! the SIMD kernel of `FloorSegments`: the cost of a collision check no longer
+//! depends on the number of segments.
+//!
+//! The clearance envelope, the maximum floor height of each bucket and of the
+//! whole level, rejects beforehand the steps flying above the floor, i.e.,
+//! most of them: no segment is even read.
+//!
+//! The segment IDs are the ones of `LevelGeometry`. The index never changes
+//! once built: any number of threads share it.
+class FloorIndex {
+public:
+  //! @brief  C'tor. Builds the index.
+  //!
+  //! @param[in] f_geometry  Geometry of the level.
+  FloorIndex(const LevelGeometry &f_geometry);
+
+  //! @brief  Find the first floor segment crossed by a step.
+  //!
+  //! Gives the same result as testing every segment by increasing ID with
+  //! `isIntersect`.
+  //!
+  //! @param[in]  f_step      The step, from the previous to the current
+  //!                         position.
+  //! @param[out] f_counters  Step counters to update. Default is nullptr,
+  //!                         none.
+  //!
+  //! @return The smallest ID of the crossed segments, -1 if none.
+  int firstIntersection(const Line_d &f_step,
+                        FloorCounters *f_counters = nullptr) const;
+
+  //! @brief  Check if a box may touch the floor: if it is below the clearance
+  //!         envelope, and overlaps the bounding box of a segment.
+  //!
+  //! Conservative: a box for which it is false crosses no segment.
+  //!
+  //! @param[in] f_min_x, f_max_x  The abscissas of the box.
+  //! @param[in] f_min_y, f_max_y  The ordinates of the box.
+  //!
+  //! @return False if no segment is within the box, else true.
+  bool mayTouch(const double f_min_x, const double f_max_x,
+                const double f_min_y, const double f_max_y) const;
+
+  //! @brief  Get the number of x-buckets.
+  int getNbBuckets() const { return nb_buckets; }
+
+private:
+  //! @brief  Get the x-bucket of an abscissa, clamped to the map.
+  //!
+  //! @param[in] x  The abscissa.
+  //!
+  //! @return The bucket index.
+  int bucket(const double x) const;
+
+  int nb_buckets; //!< Number of x-buckets.
+
+  std::vector<int> bucket_start; //!< Start of each bucket in `bucket_ids`.
+  std::vector<int> bucket_ids;   //!< Segment IDs, bucket after bucket.
+  FloorSegments bucket_segments; //!< Segments, bucket after bucket.
+
+  std::vector<double> bucket_max_y; //!< Clearance envelope, per bucket.
+  double max_height;                //!< Clearance envelope, whole level.
+};
+
+#endif
@@ -0,0 +1,216 @@
+// Standard libraries
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FLOOR_SEGMENTS_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FLOOR_SEGMENTS_SSE2
+#endif
+
+#include "FloorSegments.hpp"
+
+/************************************************************/
+void FloorSegments::push(const Line_d &f_segment) {
+  const int i{nb_segments++};
+  for (std::vector<double> *v : {&p1x, &p1y, &p2x, &p2y, &dx, &dy, &min_x,
+                                 &max_x, &min_y, &max_y})
+    v->resize(nb_segments + _SEGMENT_LANES, 0.);
+
+  p1x[i] = f_segment.p1.x;
+  p1y[i] = f_segment.p1.y;
+  p2x[i] = f_segment.p2.x;
+  p2y[i] = f_segment.p2.y;
+  dx[i] = f_segment.p2.x - f_segment.p1.x;
+  dy[i] = f_segment.p2.y - f_segment.p1.y;
+  min_x[i] = std::min(f_segment.p1.x, f_segment.p2.x);
+  max_x[i] = std::max(f_segment.p1.x, f_segment.p2.x);
+  min_y[i] = std::min(f_segment.p1.y, f_segment.p2.y);
+  max_y[i] = std::max(f_segment.p1.y, f_segment.p2.y);
+}
+
+#if defined(FLOOR_SEGMENTS_AVX2)
+//! @brief  Test 4 segments against a step, see `isIntersect`.
+//!
+//! The orientation of a triplet is encoded by two masks: val == 0, and
+//! val < 0. Two orientations differ if one of the masks differs.
+//!
+//! @param[in] s  The segments.
+//! @param[in] i  Index of the first of the 4 segments.
+//! @param[in] f_step  The step.
+//!
+//! @return The mask of the crossed segments, bit j for the segment i + j.
+int hitMask(const FloorSegments &s, const int i, const Line_d &f_step) {
+  const __m256d zero{_mm256_setzero_pd()};
+  const __m256d s1x{_mm256_set1_pd(f_step.p1.x)};
+  const __m256d s1y{_mm256_set1_pd(f_step.p1.y)};
+  const __m256d s2x{_mm256_set1_pd(f_step.p2.x)};
+  const __m256d s2y{_mm256_set1_pd(f_step.p2.y)};
+  const __m256d sdx{_mm256_set1_pd(f_step.p2.x - f_step.p1.x)};
+  const __m256d sdy{_mm256_set1_pd(f_step.p2.y - f_step.p1.y)};
+
+  const __m256d f1x{_mm256_loadu_pd(&s.p1x[i])};
+  const __m256d f1y{_mm256_loadu_pd(&s.p1y[i])};
+  const __m256d f2x{_mm256_loadu_pd(&s.p2x[i])};
+  const __m256d f2y{_mm256_loadu_pd(&s.p2y[i])};
+  const __m256d fdx{_mm256_loadu_pd(&s.dx[i])};
+  const __m256d fdy{_mm256_loadu_pd(&s.dy[i])};
+
+  // direction(s1, s2, f1), direction(s1, s2, f2)
+  const __m256d val1{_mm256_sub_pd(
+      _mm256_mul_pd(sdy, _mm256_sub_pd(f1x, s2x)),
+      _mm256_mul_pd(sdx, _mm256_sub_pd(f1y, s2y)))};
+  const __m256d val2{_mm256_sub_pd(
+      _mm256_mul_pd(sdy, _mm256_sub_pd(f2x, s2x)),
+      _mm256_mul_pd(sdx, _mm256_sub_pd(f2y, s2y)))};
+  // direction(f1, f2, s1), direction(f1, f2, s2)
+  const __m256d val3{_mm256_sub_pd(
+      _mm256_mul_pd(fdy, _mm256_sub_pd(s1x, f2x)),
+      _mm256_mul_pd(fdx, _mm256_sub_pd(s1y, f2y)))};
+  const __m256d val4{_mm256_sub_pd(
+      _mm256_mul_pd(fdy, _mm256_sub_pd(s2x, f2x)),
+      _mm256_mul_pd(fdx, _mm256_sub_pd(s2y, f2y)))};
+
+  const __m256d eq1{_mm256_cmp_pd(val1, zero, _CMP_EQ_OQ)};
+  const __m256d eq2{_mm256_cmp_pd(val2, zero, _CMP_EQ_OQ)};
+  const __m256d eq3{_mm256_cmp_pd(val3, zero, _CMP_EQ_OQ)};
+  const __m256d eq4{_mm256_cmp_pd(val4, zero, _CMP_EQ_OQ)};
+  const __m256d diff12{_mm256_or_pd(
+      _mm256_xor_pd(eq1, eq2),
+      _mm256_xor_pd(_mm256_cmp_pd(val1, zero, _CMP_LT_OQ),
+                    _mm256_cmp_pd(val2, zero, _CMP_LT_OQ)))};
+  const __m256d diff34{_mm256_or_pd(
+      _mm256_xor_pd(eq3, eq4),
+      _mm256_xor_pd(_mm256_cmp_pd(val3, zero, _CMP_LT_OQ),
+                    _mm256_cmp_pd(val4, zero, _CMP_LT_OQ)))};
+  __m256d hit{_mm256_and_pd(diff12, diff34)};
+
+  // Collinear cases: the point within the bounding box of the other segment
+  const __m256d s_min_x{_mm256_set1_pd(std::min(f_step.p1.x, f_step.p2.x))};
+  const __m256d s_max_x{_mm256_set1_pd(std::max(f_step.p1.x, f_step.p2.x))};
+  const __m256d s_min_y{_mm256_set1_pd(std::min(f_step.p1.y, f_step.p2.y))};
+  const __m256d s_max_y{_mm256_set1_pd(std::max(f_step.p1.y, f_step.p2.y))};
+  const __m256d f_min_x{_mm256_loadu_pd(&s.min_x[i])};
+  const __m256d f_max_x{_mm256_loadu_pd(&s.max_x[i])};
+  const __m256d f_min_y{_mm256_loadu_pd(&s.min_y[i])};
+  const __m256d f_max_y{_mm256_loadu_pd(&s.max_y[i])};
+  auto inBox = [](const __m256d px, const __m256d py, const __m256d min_x,
+                  const __m256d max_x, const __m256d min_y,
+                  const __m256d max_y) {
+    return _mm256_and_pd(
+        _mm256_and_pd(_mm256_cmp_pd(px, max_x, _CMP_LE_OQ),
+                      _mm256_cmp_pd(px, min_x, _CMP_GE_OQ)),
+        _mm256_and_pd(_mm256_cmp_pd(py, max_y, _CMP_LE_OQ),
+                      _mm256_cmp_pd(py, min_y, _CMP_GE_OQ)));
+  };
+  hit = _mm256_or_pd(
+      hit, _mm256_and_pd(eq1, inBox(f1x, f1y, s_min_x, s_max_x, s_min_y,
+                                    s_max_y)));
+  hit = _mm256_or_pd(
+      hit, _mm256_and_pd(eq2, inBox(f2x, f2y, s_min_x, s_max_x, s_min_y,
+                                    s_max_y)));
+  hit = _mm256_or_pd(
+      hit, _mm256_and_pd(eq3, inBox(s1x, s1y, f_min_x, f_max_x, f_min_y,
+                                    f_max_y)));
+  hit = _mm256_or_pd(
+      hit, _mm256_and_pd(eq4, inBox(s2x, s2y, f_min_x, f_max_x, f_min_y,
+                                    f_max_y)));
+  return _mm256_movemask_pd(hit);
+}
+#elif defined(FLOOR_SEGMENTS_SSE2)
+//! @brief  Same as the AVX2 `hitMask`, on 2 segments.
+int hitMask(const FloorSegments &s, const int i, const Line_d &f_step) {
+  const __m128d zero{_mm_setzero_pd()};
+  const __m128d s1x{_mm_set1_pd(f_step.p1.x)};
+  const __m128d s1y{_mm_set1_pd(f_step.p1.y)};
+  const __m128d s2x{_mm_set1_pd(f_step.p2.x)};
+  const __m128d s2y{_mm_set1_pd(f_step.p2.y)};
+  const __m128d sdx{_mm_set1_pd(f_step.p2.x - f_step.p1.x)};
+  const __m128d sdy{_mm_set1_pd(f_step.p2.y - f_step.p1.y)};
+
+  const __m128d f1x{_mm_loadu_pd(&s.p1x[i])};
+  const __m128d f1y{_mm_loadu_pd(&s.p1y[i])};
+  const __m128d f2x{_mm_loadu_pd(&s.p2x[i])};
+  const __m128d f2y{_mm_loadu_pd(&s.p2y[i])};
+  const __m128d fdx{_mm_loadu_pd(&s.dx[i])};
+  const __m128d fdy{_mm_loadu_pd(&s.dy[i])};
+
+  const __m128d val1{_mm_sub_pd(_mm_mul_pd(sdy, _mm_sub_pd(f1x, s2x)),
+                                _mm_mul_pd(sdx, _mm_sub_pd(f1y, s2y)))};
+  const __m128d val2{_mm_sub_pd(_mm_mul_pd(sdy, _mm_sub_pd(f2x, s2x)),
+                                _mm_mul_pd(sdx, _mm_sub_pd(f2y, s2y)))};
+  const __m128d val3{_mm_sub_pd(_mm_mul_pd(fdy, _mm_sub_pd(s1x, f2x)),
+                                _mm_mul_pd(fdx, _mm_sub_pd(s1y, f2y)))};
+  const __m128d val4{_mm_sub_pd(_mm_mul_pd(fdy, _mm_sub_pd(s2x, f2x)),
+                                _mm_mul_pd(fdx, _mm_sub_pd(s2y, f2y)))};
+
+  const __m128d eq1{_mm_cmpeq_pd(val1, zero)};
+  const __m128d eq2{_mm_cmpeq_pd(val2, zero)};
+  const __m128d eq3{_mm_cmpeq_pd(val3, zero)};
+  const __m128d eq4{_mm_cmpeq_pd(val4, zero)};
+  const __m128d diff12{
+      _mm_or_pd(_mm_xor_pd(eq1, eq2), _mm_xor_pd(_mm_cmplt_pd(val1, zero),
+                                                 _mm_cmplt_pd(val2, zero)))};
+  const __m128d diff34{
+      _mm_or_pd(_mm_xor_pd(eq3, eq4), _mm_xor_pd(_mm_cmplt_pd(val3, zero),
+                                                 _mm_cmplt_pd(val4, zero)))};
+  __m128d hit{_mm_and_pd(diff12, diff34)};
+
+  const __m128d s_min_x{_mm_set1_pd(std::min(f_step.p1.x, f_step.p2.x))};
+  const __m128d s_max_x{_mm_set1_pd(std::max(f_step.p1.x, f_step.p2.x))};
+  const __m128d s_min_y{_mm_set1_pd(std::min(f_step.p1.y, f_step.p2.y))};
+  const __m128d s_max_y{_mm_set1_pd(std::max(f_step.p1.y, f_step.p2.y))};
+  const __m128d f_min_x{_mm_loadu_pd(&s.min_x[i])};
+  const __m128d f_max_x{_mm_loadu_pd(&s.max_x[i])};
+  const __m128d f_min_y{_mm_loadu_pd(&s.min_y[i])};
+  const __m128d f_max_y{_mm_loadu_pd(&s.max_y[i])};
+  auto inBox = [](const __m128d px, const __m128d py, const __m128d min_x,
+                  const __m128d max_x, const __m128d min_y,
+                  const __m128d max_y) {
+    return _mm_and_pd(
+        _mm_and_pd(_mm_cmple_pd(px, max_x), _mm_cmpge_pd(px, min_x)),
+        _mm_and_pd(_mm_cmple_pd(py, max_y), _mm_cmpge_pd(py, min_y)));
+  };
+  hit = _mm_or_pd(hit, _mm_and_pd(eq1, inBox(f1x, f1y, s_min_x, s_max_x,
+                                             s_min_y, s_max_y)));
+  hit = _mm_or_pd(hit, _mm_and_pd(eq2, inBox(f2x, f2y, s_min_x, s_max_x,
+                                             s_min_y, s_max_y)));
+  hit = _mm_or_pd(hit, _mm_and_pd(eq3, inBox(s1x, s1y, f_min_x, f_max_x,
+                                             f_min_y, f_max_y)));
+  hit = _mm_or_pd(hit, _mm_and_pd(eq4, inBox(s2x, s2y, f_min_x, f_max_x,
+                                             f_min_y, f_max_y)));
+  return _mm_movemask_pd(hit);
+}
+#endif
+
+/************************************************************/
+int FloorSegments::firstIntersection(const Line_d &f_step, const int f_begin,
+                                     const int f_end) const {
+#if defined(FLOOR_SEGMENTS_AVX2) || defined(FLOOR_SEGMENTS_SSE2)
+#if defined(FLOOR_SEGMENTS_AVX2)
+  constexpr int lanes{4};
+#else
+  constexpr int lanes{2};
+#endif
+  for (int i = f_begin; i < f_end; i += lanes) {
+    // The lanes past the end of the range are dropped
+    int mask{hitMask(*this, i, f_step)};
+    if (f_end - i < lanes)
+      mask &= (1 << (f_end - i)) - 1;
+    if (mask != 0) {
+      int j{0};
+      while ((mask & (1 << j)) == 0)
+        ++j;
+      return i + j;
+    }
+  }
+#else
+  for (int i = f_begin; i < f_end; ++i) {
+    if (isIntersect(f_step, {{p1x[i], p1y[i]}, {p2x[i], p2y[i]}}))
+      return i;
+  }
+#endif
+  return -1;
+}
@@ -0,0 +1,44 @@
+#ifndef FLOOR_SEGMENTS_HPP
+#define FLOOR_SEGMENTS_HPP
+
+#include <vector>
+
+#include "Utils.hpp"
+
+constexpr int _SEGMENT_LANES{4}; //!< Widest SIMD lane count (AVX2 on doubles).
+
+//! @brief  Structure-of-arrays of floor segments, tested against a step all
+//!         at once.
+//!
+//! Holds the end points, the deltas and the bounding boxes of the segments,
+//! so that `firstIntersection` evaluates the four orientation tests and the
+//! four on-segment tests of `isIntersect` with AVX2 or SSE2 lanes when
+//! available. The operations are the very same as the scalar ones, collinear
+//! and end point cases included: the results are identical.
+struct FloorSegments {
+  std::vector<double> p1x, p1y; //!< First points.
+  std::vector<double> p2x, p2y; //!< Second points.
+  std::vector<double> dx, dy;   //!< Deltas: p2 - p1.
+  std::vector<double> min_x, max_x, min_y, max_y; //!< Bounding boxes.
+
+  int nb_segments{0}; //!< Number of segments. The arrays hold
+                      //!< `_SEGMENT_LANES` more values, so that a last
+                      //!< partial lane block can be loaded.
+
+  //! @brief  Append a segment.
+  //!
+  //! @param[in] f_segment  The segment.
+  void push(const Line_d &f_segment);
+
+  //! @brief  Find the first segment, within a range, crossed by a step.
+  //!
+  //! @param[in] f_step   The step, from the previous to the current position.
+  //! @param[in] f_begin  Index of the first segment of the range.
+  //! @param[in] f_end    Index past the last segment of the range.
+  //!
+  //! @return The smallest index of the crossed segments, -1 if none.
+  int firstIntersection(const Line_d &f_step, const int f_begin,
+                        const int f_end) const;
+};
+
+#endif
@@ -1,324 +1,770 @@
-
-#include <algorithm>
-#include <iostream>
-
-#include "Genetic.hpp"
-
-// #######################################################
-//
-//                        GENE
-//
-// #######################################################
-
-Gene::Gene(const std::int8_t f_angle, const std::int8_t f_thrust)
-    : angle{f_angle}, thrust{f_thrust} {}
-
-// #######################################################
-//
-//                      CHROMOSOME
-//
-// #######################################################
-
-//! @brief  Get a random angle in the range f_angle +/- 15.
-//!         The value is clamped between -90 and 90.
-//!
-//! @param[in] f_angle  The current angle value.
-//!
-//! @return The next random angle value.
-std::int8_t getRandAngle(const int f_angle) {
-  const int maxRand{std::min(90 - f_angle, 15) + std::min(f_angle + 90, 15) +
-                    1};
-
-  return static_cast<std::int8_t>(rand() % maxRand -
-                                  std::min(f_angle + 90, 15));
-}
-
-//! @brief  Get a random thrust power in the range f_thrust +/- 1.
-//!         The value is clamped between 0 and 4.
-//!
-//! @param[in] f_thrust  The current thrust power value.
-//!
-//! @return The next random thrust power value.
-std::int8_t getRandThrust(const int f_thrust) {
-  const int maxRandPower{std::min(4 - f_thrust, 1) + std::min(f_thrust, 1) + 1};
-
-  return static_cast<std::int8_t>(rand() % maxRandPower -
-                                  std::min(f_thrust, 1));
-}
-
-/************************************************************/
-Chromosome::Chromosome(const int f_angle, const int f_thrust) : fitness{0} {
-  int angle = f_angle;
-  int thrust = f_thrust;
-  for (int i = 0; i < _CHROMOSOME_SIZE; ++i) {
-    chromosome[i] = {getRandAngle(angle), getRandThrust(thrust)};
-    angle += chromosome[i].angle;
-    thrust += chromosome[i].thrust;
-  }
-}
-
-/************************************************************/
-Gene *Chromosome::getGene(const std::uint8_t i) {
-  if (i < _CHROMOSOME_SIZE) {
-    return &chromosome[i];
-  }
-  return nullptr;
-}
-/************************************************************/
-const Gene *Chromosome::getGene(const std::uint8_t i) const {
-  if (i < _CHROMOSOME_SIZE) {
-    return &chromosome[i];
-  }
-  return nullptr;
-}
-
-/************************************************************/
-bool Chromosome::chromosome_sorter(Chromosome const &lhs,
-                                   Chromosome const &rhs) {
-  return lhs.fitness > rhs.fitness;
-}
-
-// #######################################################
-//
-//                      POPULATION
-//
-// #######################################################
-
-GeneticPopulation::GeneticPopulation(const Rocket &f_rocket,
-                                     const int *f_floor_buffer,
-                                     const int f_size_floor)
-    : rocket_save{f_rocket}, floor_buffer{f_floor_buffer},
-      size_floor{f_size_floor}, population{&populationA[0]},
-      new_population{&populationB[0]} {
-  for (int i = 1; i < size_floor; ++i) {
-    // Statements constraints: Only 1 landing zone
-    if (floor_buffer[2 * (i - 1) + 1] == floor_buffer[2 * i + 1]) {
-      landing_zone_id = i;
-      break;
-    }
-  }
-
-  initRockets();
-  initChromosomes();
-}
-
-/************************************************************/
-void GeneticPopulation::initRockets() {
-  for (int i = 0; i < _POPULATION_SIZE; ++i) {
-    rockets_gen[i].init(rocket_save);
-  }
-}
-
-/************************************************************/
-void GeneticPopulation::initChromosomes() {
-  for (int i = 0; i < _POPULATION_SIZE; ++i) {
-    population[i] = Chromosome(rocket_save.angle, rocket_save.thrust);
-  }
-}
-
-/************************************************************/
-Chromosome *GeneticPopulation::getChromosome(const std::uint8_t i) {
-  if (i < _POPULATION_SIZE) {
-    return &population[i];
-  }
-  return nullptr;
-}
-
-/************************************************************/
-Rocket *GeneticPopulation::getRocket(const std::uint8_t i) {
-  if (i < _POPULATION_SIZE) {
-    return &rockets_gen[i];
-  }
-  return nullptr;
-}
-
-//! @brief  Given a rocket, compute its distance fitness score.
-//!
-//! The socre is calculated following the formulae:
-//!   f(d) = 1000. / (1 + 0.009999 * d)
-//!
-//!   f(0)      = 1000.000
-//!   f(10)     =  909.099
-//!   f(100)    =  500.025
-//!   f(1000)   =   90.917
-//!   f(10000)  =    9.902
-//!   f(100000) =    0.999
-//!
-//! @param[in] f_thrust  The current thrust power value.
-//!
-//! @return The next random thrust power value.
-double distance(const Rocket &rocket, const int *floor_buffer,
-                const int landing_zone_id) {
-  if (rocket.floor_id_crash == -1)
-    return 0.;
-
-  double dist{0.};
-  // Crash distance
-  if (rocket.floor_id_crash == landing_zone_id) {
-    if (rocket.isParamSuccess()) {
-      std::cout << "YOOOUUUUHHHHOOOOOUUUU" << std::endl;
-      return 99999.;
-    }
-  } else if (rocket.floor_id_crash < landing_zone_id) {
-    dist = sqrt(pow(rocket.x - floor_buffer[2 * rocket.floor_id_crash + 0], 2) +
-                pow(rocket.y - floor_buffer[2 * rocket.floor_id_crash + 1], 2));
-    for (int k = rocket.floor_id_crash + 1; k < landing_zone_id; ++k) {
-      dist += sqrt(pow(static_cast<double>(floor_buffer[2 * (k - 1) + 0]) +
-                           floor_buffer[2 * k + 0],
-                       2) +
-                   pow(static_cast<double>(floor_buffer[2 * (k - 1) + 1]) +
-                           floor_buffer[2 * k + 1],
-                       2));
-    }
-  } else {
-    dist = sqrt(
-        pow(rocket.x - floor_buffer[2 * (rocket.floor_id_crash - 1) + 0], 2) +
-        pow(rocket.y - floor_buffer[2 * (rocket.floor_id_crash - 1) + 1], 2));
-
-    for (int k = rocket.floor_id_crash - 1; k > landing_zone_id; --k) {
-      dist += sqrt(pow(static_cast<double>(floor_buffer[2 * (k - 1) + 0]) +
-                           floor_buffer[2 * k + 0],
-                       2) +
-                   pow(static_cast<double>(floor_buffer[2 * (k - 1) + 1]) +
-                           floor_buffer[2 * k + 1],
-                       2));
-    }
-  }
-  return 1000. / (1. + 0.009999 * dist);
-}
-
-//! @brief  Given horizontal and vertical speeds, compute the fitness penalty.
-//!
-//! The fitness penalty is calculated following the formulaes:
-//!   Horizontal speed: s >= 0 in m/s-1
-//!     h(s) = 0.00036057692307692 * s^2 + 0.069711538461538 * s
-//!            - 3.3653846153846
-//!
-//!     h(0)   = 3.3653846153846
-//!     h(40)  = 0
-//!     h(200) = -25
-//!     h(300) = -50
-//!
-//!   Vertical speed: s >= 0 in m/s-1
-//!     v(s) = 0.0003968253968254 * s ^ 2 + 0.051587301587302 * s
-//!            - 1.1904761904762
-//!
-//!     v(0)   = 1.1904761904762
-//!     v(25)  = 0
-//!     v(200) = -25
-//!     v(300) = -50
-//!
-//!   Speed fitness penalty: sx, sy >= 0 in m/s-1
-//!     f(sx, sy) = -5 * (h(sx) + v(sy))
-//!
-//! @param[in] vx  The horizontal speed.
-//! @param[in] vy  The vertical speed.
-//!
-//! @return The speed fitness penalty.
-double speed(const double vx, const double vy) {
-  double scoreX =
-      0.00036057692307692 * vx * vx + 0.069711538461538 * vx - 3.3653846153846;
-  double scoreY =
-      0.0003968253968254 * vy * vy + 0.051587301587302 * vy - 1.1904761904762;
-
-  return -5. * (scoreX + scoreY);
-}
-
-/************************************************************/
-void GeneticPopulation::mutate(const int idxStart) {
-  double sum_fitness{0.};
-  // Compute every fitness
-  for (int i = 0; i < _POPULATION_SIZE; ++i) {
-    if (rockets_gen[i].isAlive) {
-      population[i].fitness = 0;
-    } else {
-      population[i].fitness =
-          distance(rockets_gen[i], floor_buffer, landing_zone_id);
-    }
-
-    if (rockets_gen[i].floor_id_crash == landing_zone_id) {
-      population[i].fitness +=
-          speed(abs(rockets_gen[i].vx), abs(rockets_gen[i].vy));
-    }
-
-    sum_fitness += population[i].fitness;
-  }
-
-  // Sort the fitness
-  std::sort(population,
-            population + sizeof(populationA) / sizeof(populationA[0]),
-            &Chromosome::chromosome_sorter);
-
-  double cum_sum{0.};
-  for (int i = _POPULATION_SIZE - 1; i >= 0; --i) {
-    population[i].fitness = cum_sum + population[i].fitness / sum_fitness;
-    cum_sum = population[i].fitness;
-  }
-
-  // Elitism
-  for (int i = 0; i < _ELITISM_IDX; ++i) {
-    new_population[i] = population[i];
-  }
-
-  // Continuous Genetic Algorithm
-  for (int i = _ELITISM_IDX; i < _POPULATION_SIZE; i += 2) {
-    int idxParent1{_POPULATION_SIZE};
-    while (idxParent1 == _POPULATION_SIZE) {
-      idxParent1 = 1;
-      const double choice1{rand() / static_cast<double>(RAND_MAX)};
-      for (; idxParent1 < _POPULATION_SIZE; ++idxParent1) {
-        if (population[idxParent1].fitness < choice1) {
-          idxParent1--;
-          break;
-        }
-      }
-    }
-
-    int idxParent2{_POPULATION_SIZE};
-    while (idxParent2 == idxParent1 || idxParent2 == _POPULATION_SIZE) {
-      idxParent2 = 1;
-      const double choice2{rand() / static_cast<double>(RAND_MAX)};
-      for (; idxParent2 < _POPULATION_SIZE; ++idxParent2) {
-        if (population[idxParent2].fitness < choice2) {
-          idxParent2--;
-          break;
-        }
-      }
-    }
-
-    for (int g = idxStart; g < _CHROMOSOME_SIZE; ++g) {
-      const double r{rand() / static_cast<double>(RAND_MAX)};
-      if (r > _MUTATION_RATE) {
-        const double angleP0 = population[idxParent1].chromosome[g].angle;
-        const double angleP1 = population[idxParent2].chromosome[g].angle;
-        const double powerP0 = population[idxParent1].chromosome[g].thrust;
-        const double powerP1 = population[idxParent2].chromosome[g].thrust;
-
-        new_population[i].chromosome[g].angle =
-            static_cast<std::int8_t>(r * angleP0 + (1 - r) * angleP1);
-        new_population[i].chromosome[g].thrust =
-            static_cast<std::int8_t>(r * powerP0 + (1 - r) * powerP1);
-        if (i != _POPULATION_SIZE - 1) {
-          new_population[i + 1].chromosome[g].angle =
-              static_cast<std::int8_t>((1 - r) * angleP0 + r * angleP1);
-          new_population[i + 1].chromosome[g].thrust =
-              static_cast<std::int8_t>((1 - r) * powerP0 + r * powerP1);
-        }
-      } else {
-        new_population[i].chromosome[g].angle = getRandAngle(rocket_save.angle);
-        new_population[i].chromosome[g].thrust =
-            getRandThrust(rocket_save.thrust);
-        if (i != _POPULATION_SIZE - 1) {
-          new_population[i + 1].chromosome[g].angle =
-              getRandAngle(rocket_save.angle);
-          new_population[i + 1].chromosome[g].thrust =
-              getRandThrust(rocket_save.thrust);
-        }
-      }
-    }
-  }
-
-  Chromosome *tmp = population;
-  population = new_population;
-  new_population = tmp;
-}
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CROSSOVER_AVX2
+#define PACKING_AVX2
+#endif
+
+#include "DistanceField.hpp"
+#include "Genetic.hpp"
+#include "LevelGeometry.hpp"
+#include "ThreadPool.hpp"
+
+constexpr int _SHARD_PAIRS{8}; //!< Pairs of children per task of the
+                               //!< deterministic mode.
+
+// #######################################################
+//
+//                        GENE
+//
+// #######################################################
+
+Gene::Gene(const std::int8_t f_angle, const std::int8_t f_thrust)
+    : angle{f_angle}, thrust{f_thrust} {}
+
+/************************************************************/
+GeneMatrix::GeneMatrix(const int f_rows, const int f_cols)
+    : cols{f_cols},
+      stride{(f_cols * static_cast<int>(sizeof(Gene)) + _GENE_ALIGN - 1) /
+             _GENE_ALIGN * _GENE_ALIGN / static_cast<int>(sizeof(Gene))},
+      storage(static_cast<std::size_t>(f_rows) * stride +
+              _GENE_ALIGN / sizeof(Gene)) {
+  // The first gene on a cache line, the others follow
+  const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(
+      storage.data())};
+  const std::uintptr_t aligned{(address + _GENE_ALIGN - 1) &
+                               ~static_cast<std::uintptr_t>(_GENE_ALIGN - 1)};
+  first = storage.data() + (aligned - address) / sizeof(Gene);
+}
+
+/************************************************************/
+GeneRow GeneMatrix::row(const int i) {
+  return {first + static_cast<std::size_t>(i) * stride, cols};
+}
+
+// #######################################################
+//
+//                      CHROMOSOME
+//
+// #######################################################
+
+//! @brief  Get the largest decrease of the angle in a step: 15, less close
+//!         to -90.
+//!
+//! @param[in] f_angle  The current angle value.
+//!
+//! @return The decrease.
+inline int getAngleOffset(const int f_angle) {
+  return std::min(f_angle + 90, 15);
+}
+
+//! @brief  Same as `getAngleOffset`, for the thrust power: 1, less at 0.
+inline int getThrustOffset(const int f_thrust) {
+  return std::min(f_thrust, 1);
+}
+
+//! @brief  Get the number of angles in the range f_angle +/- 15, clamped
+//!         between -90 and 90.
+//!
+//! @param[in] f_angle  The current angle value.
+//!
+//! @return The number of angles.
+inline int getAngleRange(const int f_angle) {
+  return std::min(90 - f_angle, 15) + getAngleOffset(f_angle) + 1;
+}
+
+//! @brief  Same as `getAngleRange`, for the thrust power in the range
+//!         f_thrust +/- 1, clamped between 0 and 4.
+inline int getThrustRange(const int f_thrust) {
+  return std::min(4 - f_thrust, 1) + getThrustOffset(f_thrust) + 1;
+}
+
+//! @brief  Get a random angle in the range f_angle +/- 15.
+//!         The value is clamped between -90 and 90.
+//!
+//! @param[in] f_angle  The current angle value.
+//! @param[in] f_bits   Random bits, see `Random::toBounded`.
+//!
+//! @return The next random angle value.
+std::int8_t getRandAngle(const int f_angle, const std::uint32_t f_bits) {
+  return static_cast<std::int8_t>(
+      Random::toBounded(f_bits, getAngleRange(f_angle)) -
+      getAngleOffset(f_angle));
+}
+
+//! @brief  Get a random thrust power in the range f_thrust +/- 1.
+//!         The value is clamped between 0 and 4.
+//!
+//! @param[in] f_thrust  The current thrust power value.
+//! @param[in] f_bits    Random bits, see `Random::toBounded`.
+//!
+//! @return The next random thrust power value.
+std::int8_t getRandThrust(const int f_thrust, const std::uint32_t f_bits) {
+  return static_cast<std::int8_t>(
+      Random::toBounded(f_bits, getThrustRange(f_thrust)) -
+      getThrustOffset(f_thrust));
+}
+
+/************************************************************/
+Chromosome::Chromosome(const int f_size)
+    : fitness{0}, evaluated_from{-1}, own(f_size) {
+  chromosome = {own.data(), f_size};
+}
+
+/************************************************************/
+Chromosome::Chromosome(Random &f_random, const int f_angle,
+                       const int f_thrust, const int f_size)
+    : Chromosome(f_size) {
+  std::vector<std::uint32_t> bits(2 * f_size);
+  f_random.fill(bits.data(), 2 * f_size);
+
+  int angle = f_angle;
+  int thrust = f_thrust;
+  for (int i = 0; i < f_size; ++i) {
+    chromosome[i] = {getRandAngle(angle, bits[2 * i]),
+                     getRandThrust(thrust, bits[2 * i + 1])};
+    angle += chromosome[i].angle;
+    thrust += chromosome[i].thrust;
+  }
+}
+
+/************************************************************/
+Chromosome::Chromosome(const GeneRow &f_row)
+    : chromosome{f_row}, fitness{0}, evaluated_from{-1} {}
+
+/************************************************************/
+Chromosome::Chromosome(const Chromosome &f_other)
+    : fitness{f_other.fitness}, rocket{f_other.rocket},
+      evaluated_from{f_other.evaluated_from},
+      own(f_other.chromosome.begin(), f_other.chromosome.end()) {
+  chromosome = {own.data(), f_other.chromosome.count};
+}
+
+/************************************************************/
+Chromosome &Chromosome::operator=(const Chromosome &f_other) {
+  if (this == &f_other)
+    return *this;
+
+  if (own.empty() && chromosome.genes != nullptr) {
+    std::copy(f_other.chromosome.begin(), f_other.chromosome.end(),
+              chromosome.begin());
+  } else {
+    own.assign(f_other.chromosome.begin(), f_other.chromosome.end());
+    chromosome = {own.data(), f_other.chromosome.count};
+  }
+  fitness = f_other.fitness;
+  rocket = f_other.rocket;
+  evaluated_from = f_other.evaluated_from;
+  return *this;
+}
+
+/************************************************************/
+int Chromosome::size() const { return static_cast<int>(chromosome.size()); }
+
+/************************************************************/
+Gene *Chromosome::getGene(const int i) {
+  if (0 <= i && size() > 0) {
+    return &chromosome[i % size()];
+  }
+  return nullptr;
+}
+/************************************************************/
+const Gene *Chromosome::getGene(const int i) const {
+  if (0 <= i && size() > 0) {
+    return &chromosome[i % size()];
+  }
+  return nullptr;
+}
+
+/************************************************************/
+bool Chromosome::chromosome_sorter(Chromosome const &lhs,
+                                   Chromosome const &rhs) {
+  return lhs.fitness > rhs.fitness;
+}
+
+// #######################################################
+//
+//                      CROSSOVER
+//
+// #######################################################
+
+//! @brief  Breed one gene of two children, see `crossoverGenes`.
+//!
+//! @param[in]  g  Index of the gene.
+//! @param[in]  f_parent1, ..., f_thrust_offset  See `crossoverGenes`.
+inline void crossoverGene(const int g, const Gene *f_parent1,
+                          const Gene *f_parent2, Gene *f_child1,
+                          Gene *f_child2, const int f_size,
+                          const std::uint32_t *f_bits, const int f_threshold,
+                          const int f_angle_offset,
+                          const int f_thrust_offset) {
+  const int weight{static_cast<int>(f_bits[g] >> 16)};
+  if (weight > f_threshold) {
+    const float r{weight * (1.f / 65536.f)};
+    const float angleP0 = f_parent1[g].angle;
+    const float angleP1 = f_parent2[g].angle;
+    const float powerP0 = f_parent1[g].thrust;
+    const float powerP1 = f_parent2[g].thrust;
+
+    f_child1[g].angle =
+        static_cast<std::int8_t>(r * angleP0 + (1 - r) * angleP1);
+    f_child1[g].thrust =
+        static_cast<std::int8_t>(r * powerP0 + (1 - r) * powerP1);
+    if (f_child2) {
+      f_child2[g].angle =
+          static_cast<std::int8_t>((1 - r) * angleP0 + r * angleP1);
+      f_child2[g].thrust =
+          static_cast<std::int8_t>((1 - r) * powerP0 + r * powerP1);
+    }
+  } else {
+    f_child1[g].angle = static_cast<std::int8_t>(
+        static_cast<int>(f_bits[f_size + g]) - f_angle_offset);
+    f_child1[g].thrust = static_cast<std::int8_t>(
+        static_cast<int>(f_bits[2 * f_size + g]) - f_thrust_offset);
+    if (f_child2) {
+      f_child2[g].angle = static_cast<std::int8_t>(
+          static_cast<int>(f_bits[3 * f_size + g]) - f_angle_offset);
+      f_child2[g].thrust = static_cast<std::int8_t>(
+          static_cast<int>(f_bits[4 * f_size + g]) - f_thrust_offset);
+    }
+  }
+}
+
+#if defined(CROSSOVER_AVX2)
+//! @brief  Blend the genes of the parents, see `crossoverGenes`.
+//!
+//! @param[in] f_r, f_s    Weights of the first parent and of the second one.
+//! @param[in] f_p1, f_p2  Angles, or thrust powers, of the parents.
+//!
+//! @return The blended values, truncated.
+inline __m256i blendLanes(const __m256 f_r, const __m256 f_s, const __m256 f_p1,
+                          const __m256 f_p2) {
+  return _mm256_cvttps_epi32(
+      _mm256_add_ps(_mm256_mul_ps(f_r, f_p1), _mm256_mul_ps(f_s, f_p2)));
+}
+
+//! @brief  Store 8 genes of a child: the blended values, else the random
+//!         ones.
+//!
+//! @param[out] f_child          The first gene.
+//! @param[in]  f_angles         Blended angles.
+//! @param[in]  f_thrusts        Blended thrust powers.
+//! @param[in]  f_blended        Mask of the blended genes.
+//! @param[in]  f_random_angles  Random angles, offsets subtracted.
+//! @param[in]  f_random_thrusts Random thrust powers, offsets subtracted.
+//! @param[in]  f_merge          Shuffle of the packed values back to genes.
+inline void storeLanes(Gene *f_child, const __m256i f_angles,
+                       const __m256i f_thrusts, const __m256i f_blended,
+                       const __m256i f_random_angles,
+                       const __m256i f_random_thrusts,
+                       const __m128i f_merge) {
+  const __m256i angles{
+      _mm256_blendv_epi8(f_random_angles, f_angles, f_blended)};
+  const __m256i thrusts{
+      _mm256_blendv_epi8(f_random_thrusts, f_thrusts, f_blended)};
+
+  // 4 angles then 4 thrust powers in each half, as int16, then as int8
+  const __m256i packed{_mm256_packs_epi32(angles, thrusts)};
+  const __m128i bytes{_mm_packs_epi16(_mm256_castsi256_si128(packed),
+                                      _mm256_extracti128_si256(packed, 1))};
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(f_child),
+                   _mm_shuffle_epi8(bytes, f_merge));
+}
+
+//! @brief  Load 8 random values, offset subtracted.
+//!
+//! @param[in] f_bits    The values.
+//! @param[in] f_offset  The offset.
+//!
+//! @return The values.
+inline __m256i loadRandom(const std::uint32_t *f_bits, const __m256i f_offset) {
+  return _mm256_sub_epi32(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(f_bits)),
+      f_offset);
+}
+#endif
+
+/************************************************************/
+void crossoverGenes(const Gene *f_parent1, const Gene *f_parent2,
+                    Gene *f_child1, Gene *f_child2, const int f_size,
+                    const std::uint32_t *f_bits, const int f_threshold,
+                    const int f_angle_offset, const int f_thrust_offset) {
+  int g{0};
+#if defined(CROSSOVER_AVX2)
+  static_assert(sizeof(Gene) == 2, "8 genes in 16 bytes");
+
+  // Angles, then thrust powers, of 8 genes; and back
+  const __m128i split{_mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9,
+                                    11, 13, 15)};
+  const __m128i merge{_mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10,
+                                    14, 11, 15)};
+  const __m256i threshold{_mm256_set1_epi32(f_threshold)};
+  const __m256i angle_offset{_mm256_set1_epi32(f_angle_offset)};
+  const __m256i thrust_offset{_mm256_set1_epi32(f_thrust_offset)};
+  const __m256 scale{_mm256_set1_ps(1.f / 65536.f)};
+  const __m256 one{_mm256_set1_ps(1.f)};
+
+  for (; g + 8 <= f_size; g += 8) {
+    const __m256i weight{_mm256_srli_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&f_bits[g])),
+        16)};
+    const __m256i blended{_mm256_cmpgt_epi32(weight, threshold)};
+    const __m256 r{_mm256_mul_ps(_mm256_cvtepi32_ps(weight), scale)};
+    const __m256 s{_mm256_sub_ps(one, r)};
+
+    const __m128i genes1{_mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&f_parent1[g])),
+        split)};
+    const __m128i genes2{_mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&f_parent2[g])),
+        split)};
+    const __m256 angleP0{_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(genes1))};
+    const __m256 angleP1{_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(genes2))};
+    const __m256 powerP0{_mm256_cvtepi32_ps(
+        _mm256_cvtepi8_epi32(_mm_srli_si128(genes1, 8)))};
+    const __m256 powerP1{_mm256_cvtepi32_ps(
+        _mm256_cvtepi8_epi32(_mm_srli_si128(genes2, 8)))};
+
+    storeLanes(&f_child1[g], blendLanes(r, s, angleP0, angleP1),
+               blendLanes(r, s, powerP0, powerP1), blended,
+               loadRandom(&f_bits[f_size + g], angle_offset),
+               loadRandom(&f_bits[2 * f_size + g], thrust_offset), merge);
+    if (f_child2) {
+      storeLanes(&f_child2[g], blendLanes(s, r, angleP0, angleP1),
+                 blendLanes(s, r, powerP0, powerP1), blended,
+                 loadRandom(&f_bits[3 * f_size + g], angle_offset),
+                 loadRandom(&f_bits[4 * f_size + g], thrust_offset), merge);
+    }
+  }
+#endif
+
+  // The last genes, or all of them without AVX2
+  for (; g < f_size; ++g) {
+    crossoverGene(g, f_parent1, f_parent2, f_child1, f_child2, f_size, f_bits,
+                  f_threshold, f_angle_offset, f_thrust_offset);
+  }
+}
+
+/************************************************************/
+void crossoverGenesScalar(const Gene *f_parent1, const Gene *f_parent2,
+                          Gene *f_child1, Gene *f_child2, const int f_size,
+                          const std::uint32_t *f_bits, const int f_threshold,
+                          const int f_angle_offset,
+                          const int f_thrust_offset) {
+  for (int g = 0; g < f_size; ++g) {
+    crossoverGene(g, f_parent1, f_parent2, f_child1, f_child2, f_size, f_bits,
+                  f_threshold, f_angle_offset, f_thrust_offset);
+  }
+}
+
+// #######################################################
+//
+//                     PACKED GENES
+//
+// #######################################################
+
+void packGenes(const Gene *f_genes, PackedGene *f_packed, const int f_size) {
+  int g{0};
+#if defined(PACKING_AVX2)
+  // A gene per int16 lane: the angle in the low byte, the thrust power in the
+  // high one; biased byte by byte, then both fields moved side by side
+  const __m256i bias{_mm256_set1_epi16(
+      _PACKED_THRUST_BIAS << 8 | _PACKED_ANGLE_BIAS)};
+  const __m256i angle_mask{_mm256_set1_epi16(0x1F)};
+  const __m256i thrust_mask{_mm256_set1_epi16(0x3 << _PACKED_THRUST_SHIFT)};
+  for (; g + 16 <= f_size; g += 16) {
+    const __m256i genes{_mm256_add_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&f_genes[g])),
+        bias)};
+    const __m256i packed{_mm256_or_si256(
+        _mm256_and_si256(genes, angle_mask),
+        _mm256_and_si256(_mm256_srli_epi16(genes, 8 - _PACKED_THRUST_SHIFT),
+                         thrust_mask))};
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&f_packed[g]),
+                     _mm_packus_epi16(_mm256_castsi256_si128(packed),
+                                      _mm256_extracti128_si256(packed, 1)));
+  }
+#endif
+
+  // The last genes, or all of them without AVX2
+  for (; g < f_size; ++g)
+    f_packed[g] = packGene(f_genes[g]);
+}
+
+/************************************************************/
+void unpackGenes(const PackedGene *f_packed, Gene *f_genes, const int f_size) {
+  int g{0};
+#if defined(PACKING_AVX2)
+  // The other way round: both fields back to their bytes, then unbiased
+  const __m256i bias{_mm256_set1_epi16(
+      _PACKED_THRUST_BIAS << 8 | _PACKED_ANGLE_BIAS)};
+  const __m256i angle_mask{_mm256_set1_epi16(0x1F)};
+  const __m256i thrust_mask{_mm256_set1_epi16(0x3 << 8)};
+  for (; g + 16 <= f_size; g += 16) {
+    const __m256i packed{_mm256_cvtepu8_epi16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&f_packed[g])))};
+    const __m256i genes{_mm256_or_si256(
+        _mm256_and_si256(packed, angle_mask),
+        _mm256_and_si256(_mm256_slli_epi16(packed, 8 - _PACKED_THRUST_SHIFT),
+                         thrust_mask))};
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(&f_genes[g]),
+                        _mm256_sub_epi8(genes, bias));
+  }
+#endif
+
+  for (; g < f_size; ++g)
+    f_genes[g] = unpackGene(f_packed[g]);
+}
+
+/************************************************************/
+PackedGeneMatrix::PackedGeneMatrix(const int f_rows, const int f_cols)
+    : cols{f_cols},
+      stride{(f_cols + _GENE_ALIGN - 1) / _GENE_ALIGN * _GENE_ALIGN},
+      storage(static_cast<std::size_t>(f_rows) * stride + _GENE_ALIGN) {
+  // As `GeneMatrix`, the first gene on a cache line
+  const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(
+      storage.data())};
+  const std::uintptr_t aligned{(address + _GENE_ALIGN - 1) &
+                               ~static_cast<std::uintptr_t>(_GENE_ALIGN - 1)};
+  first = storage.data() + (aligned - address);
+}
+
+/************************************************************/
+PackedGene *PackedGeneMatrix::row(const int i) {
+  return first + static_cast<std::size_t>(i) * stride;
+}
+
+/************************************************************/
+const PackedGene *PackedGeneMatrix::row(const int i) const {
+  return first + static_cast<std::size_t>(i) * stride;
+}
+
+/************************************************************/
+void PackedGeneMatrix::pack(const int i, const Chromosome &f_chromosome) {
+  packGenes(f_chromosome.chromosome.data(), row(i), cols);
+}
+
+/************************************************************/
+void PackedGeneMatrix::unpack(const int i, Chromosome &f_chromosome) const {
+  unpackGenes(row(i), f_chromosome.chromosome.data(), cols);
+  f_chromosome.evaluated_from = -1;
+}
+
+// #######################################################
+//
+//                      POPULATION
+//
+// #######################################################
+
+GeneticPopulation::GeneticPopulation(const Rocket &f_rocket,
+                                     const LevelGeometry &f_geometry,
+                                     const DistanceField *f_field,
+                                     const std::uint64_t f_seed,
+                                     const GeneticConfig &f_config)
+    : rocket_save{f_rocket}, landing_zone_id{f_geometry.landing_zone_id},
+      config{f_config},
+      genes(2 * f_config.population_size, f_config.chromosome_size),
+      population(f_config.population_size),
+      new_population(f_config.population_size),
+      spare(f_config.population_size), ranking(f_config.population_size),
+      fitness(f_config.population_size),
+      rockets_gen(f_config.population_size), geometry{f_geometry},
+      field{f_field}, rng{f_seed}, seed{f_seed}, generation{0} {
+  chromosomes.reserve(2 * config.population_size);
+  for (int slot = 0; slot < 2 * config.population_size; ++slot)
+    chromosomes.emplace_back(genes.row(slot));
+  std::iota(population.begin(), population.end(), 0);
+  std::iota(spare.begin(), spare.end(), config.population_size);
+  initRockets();
+  initChromosomes();
+}
+
+/************************************************************/
+void GeneticPopulation::initRockets() {
+  for (int i = 0; i < config.population_size; ++i) {
+    rockets_gen[i].init(rocket_save);
+  }
+}
+
+/************************************************************/
+void GeneticPopulation::initChromosomes() {
+  for (int i = 0; i < config.population_size; ++i) {
+    chromosomes[population[i]] =
+        Chromosome(rng, rocket_save.angle, rocket_save.thrust,
+                   config.chromosome_size);
+  }
+}
+
+/************************************************************/
+Chromosome *GeneticPopulation::getChromosome(const int i) {
+  if (0 <= i && i < config.population_size) {
+    return &chromosomes[population[i]];
+  }
+  return nullptr;
+}
+
+/************************************************************/
+Rocket *GeneticPopulation::getRocket(const int i) {
+  if (0 <= i && i < config.population_size) {
+    return &rockets_gen[i];
+  }
+  return nullptr;
+}
+
+/************************************************************/
+bool GeneticPopulation::isEvaluated(const int i, const int idxStart) const {
+  return chromosomes[population[i]].evaluated_from == idxStart;
+}
+
+/************************************************************/
+const Chromosome *GeneticPopulation::getRanked(const int i) const {
+  if (0 <= i && i < std::max(1, config.elitismIdx())) {
+    return &chromosomes[ranking[i]];
+  }
+  return nullptr;
+}
+
+/************************************************************/
+void GeneticPopulation::setGenes(const int i, const Gene *f_genes) {
+  Chromosome &chromosome{chromosomes[population[i]]};
+  std::copy(f_genes, f_genes + config.chromosome_size,
+            chromosome.chromosome.begin());
+  chromosome.evaluated_from = -1;
+}
+
+/************************************************************/
+void GeneticPopulation::setGenes(const int i, const PackedGene *f_packed) {
+  Chromosome &chromosome{chromosomes[population[i]]};
+  unpackGenes(f_packed, chromosome.chromosome.data(), config.chromosome_size);
+  chromosome.evaluated_from = -1;
+}
+
+/************************************************************/
+void GeneticPopulation::advance(const int idxStart) {
+  // The slot of the gene played, the same in every ring
+  const int slot{idxStart % config.chromosome_size};
+  for (int i = 0; i < config.population_size; ++i) {
+    Chromosome &chromosome{chromosomes[population[i]]};
+    const std::uint64_t bits{rng.next()};
+    chromosome.chromosome[slot] = {
+        getRandAngle(rocket_save.angle, static_cast<std::uint32_t>(bits)),
+        getRandThrust(rocket_save.thrust,
+                      static_cast<std::uint32_t>(bits >> 32))};
+    chromosome.evaluated_from = -1;
+  }
+}
+
+/************************************************************/
+template <class Real>
+double distance(const BasicRocket<Real> &rocket,
+                const LevelGeometry &geometry) {
+  using std::sqrt;
+  if (rocket.floor_id_crash == -1)
+    return 0.;
+
+  // Crash distance
+  if (rocket.floor_id_crash == geometry.landing_zone_id)
+    return rocket.isParamSuccess() ? 99999. : 1000.;
+
+  const Coord_d &p{geometry.towardLanding(rocket.floor_id_crash)};
+  const Real dx{rocket.x - Real(p.x)};
+  const Real dy{rocket.y - Real(p.y)};
+  const double dist{static_cast<double>(sqrt(dx * dx + dy * dy)) +
+                    geometry.arcToLanding(rocket.floor_id_crash)};
+  return 1000. / (1. + 0.009999 * dist);
+}
+
+template double distance<double>(const BasicRocket<double> &,
+                                 const LevelGeometry &);
+template double distance<float>(const BasicRocket<float> &,
+                                const LevelGeometry &);
+template double distance<Fixed>(const BasicRocket<Fixed> &,
+                                const LevelGeometry &);
+
+/************************************************************/
+template <class Real>
+double distance(const BasicRocket<Real> &rocket, const DistanceField &field) {
+  if (rocket.floor_id_crash == -1)
+    return 0.;
+
+  // Crash distance
+  if (rocket.floor_id_crash == field.landing_zone_id)
+    return rocket.isParamSuccess() ? 99999. : 1000.;
+
+  // The crash position is past the floor: start from the one before
+  const double dist{field.at(static_cast<double>(rocket.pX),
+                             static_cast<double>(rocket.pY))};
+  return 1000. / (1. + 0.009999 * dist);
+}
+
+template double distance<double>(const BasicRocket<double> &,
+                                 const DistanceField &);
+template double distance<float>(const BasicRocket<float> &,
+                                const DistanceField &);
+template double distance<Fixed>(const BasicRocket<Fixed> &,
+                                const DistanceField &);
+
+/************************************************************/
+template <class Real> double speed(const Real vx, const Real vy) {
+  const Real scoreX{Real(0.00036057692307692) * vx * vx +
+                    Real(0.069711538461538) * vx - Real(3.3653846153846)};
+  const Real scoreY{Real(0.0003968253968254) * vy * vy +
+                    Real(0.051587301587302) * vy - Real(1.1904761904762)};
+
+  return -5. * static_cast<double>(scoreX + scoreY);
+}
+
+template double speed<double>(const double, const double);
+template double speed<float>(const float, const float);
+template double speed<Fixed>(const Fixed, const Fixed);
+
+/************************************************************/
+void GeneticPopulation::crossover(const Chromosome &f_parent1,
+                                  const Chromosome &f_parent2,
+                                  Chromosome &f_child1, Chromosome *f_child2,
+                                  const std::uint32_t *f_bits) const {
+  const Gene *parent1{f_parent1.chromosome.data()};
+  const Gene *parent2{f_parent2.chromosome.data()};
+  Gene *child1{f_child1.chromosome.data()};
+  Gene *child2{f_child2 ? f_child2->chromosome.data() : nullptr};
+
+  f_child1.evaluated_from = -1;
+  if (f_child2)
+    f_child2->evaluated_from = -1;
+
+  // The same slot holds the same gene of the flight in every ring
+  crossoverGenes(parent1, parent2, child1, child2, config.chromosome_size,
+                 f_bits, static_cast<int>(config.mutation_rate * 65536),
+                 getAngleOffset(rocket_save.angle),
+                 getThrustOffset(rocket_save.thrust));
+}
+
+/************************************************************/
+template <class Selection>
+void GeneticPopulation::mutate(const int idxStart, ThreadPool *f_pool) {
+  const int population_size{config.population_size};
+
+  // Compute every fitness, unless still evaluated
+  for (int i = 0; i < population_size; ++i) {
+    Chromosome &chromosome{chromosomes[population[i]]};
+    if (chromosome.evaluated_from == idxStart) {
+      rockets_gen[i] = chromosome.rocket;
+      continue;
+    }
+    chromosome.rocket = rockets_gen[i];
+    chromosome.evaluated_from = idxStart;
+
+    if (rockets_gen[i].isAlive) {
+      chromosome.fitness = 0;
+    } else {
+      chromosome.fitness = field ? distance(rockets_gen[i], *field)
+                                 : distance(rockets_gen[i], geometry);
+    }
+
+    if (rockets_gen[i].floor_id_crash == landing_zone_id) {
+      chromosome.fitness +=
+          speed(std::abs(rockets_gen[i].vx), std::abs(rockets_gen[i].vy));
+    }
+  }
+
+  // Rank the slots, not the chromosomes, and only the elites: the fittest
+  // one first, kept for the incremental search even without elitism
+  const int elitism_idx{config.elitismIdx()};
+  std::copy(population.begin(), population.end(), ranking.begin());
+  std::partial_sort(ranking.begin(),
+                    ranking.begin() + std::max(1, elitism_idx), ranking.end(),
+                    [this](const int lhs, const int rhs) {
+                      return Chromosome::chromosome_sorter(chromosomes[lhs],
+                                                           chromosomes[rhs]);
+                    });
+
+  for (int i = 0; i < population_size; ++i) {
+    fitness[i] = chromosomes[ranking[i]].fitness;
+  }
+  Selection selection;
+  selection.build(fitness.data(), population_size);
+
+  // Elitism: the slots go on, the children take the spare ones
+  for (int i = 0; i < elitism_idx; ++i) {
+    new_population[i] = ranking[i];
+  }
+  for (int i = elitism_idx; i < population_size; ++i) {
+    new_population[i] = spare[i - elitism_idx];
+  }
+
+  // Continuous Genetic Algorithm: two children from two parents
+  const auto breed = [&](const int i, auto &f_random, std::uint32_t *f_bits) {
+    // Two distinct parents, unless a single chromosome has any fitness
+    const int idxParent1{selection.draw(f_random)};
+    int idxParent2{selection.draw(f_random)};
+    for (int retry = 0; idxParent2 == idxParent1 && retry < population_size;
+         ++retry) {
+      idxParent2 = selection.draw(f_random);
+    }
+
+    // Every random value of the two children at once: the crossover weights,
+    // then the genes of both if mutated, a block each
+    const int nbGenes{config.chromosome_size};
+    f_random.fill(f_bits, nbGenes);
+    for (int child = 0; child < 2; ++child) {
+      f_random.fillBounded(&f_bits[(1 + 2 * child) * nbGenes], nbGenes,
+                           getAngleRange(rocket_save.angle));
+      f_random.fillBounded(&f_bits[(2 + 2 * child) * nbGenes], nbGenes,
+                           getThrustRange(rocket_save.thrust));
+    }
+
+    const Chromosome &parent1{chromosomes[ranking[idxParent1]]};
+    const Chromosome &parent2{chromosomes[ranking[idxParent2]]};
+    Chromosome &child1{chromosomes[new_population[i]]};
+    Chromosome *child2{i != population_size - 1
+                           ? &chromosomes[new_population[i + 1]]
+                           : nullptr};
+    crossover(parent1, parent2, child1, child2, f_bits);
+  };
+
+  const int nbBits{5 * config.chromosome_size};
+  if (!config.deterministic) {
+    std::vector<std::uint32_t> bits(nbBits);
+    for (int i = elitism_idx; i < population_size; i += 2)
+      breed(i, rng, bits.data());
+  } else {
+    // Shards of `_SHARD_PAIRS` pairs, each pair with its own stream: the
+    // children depend neither on the shards nor on their workers
+    const int nbPairs{(population_size - elitism_idx + 1) / 2};
+    const auto shard = [&](const int f_shard, const int) {
+      std::vector<std::uint32_t> bits(nbBits);
+      const int end{std::min(nbPairs, (f_shard + 1) * _SHARD_PAIRS)};
+      for (int pair = f_shard * _SHARD_PAIRS; pair < end; ++pair) {
+        const int i{elitism_idx + 2 * pair};
+        CounterRandom random(seed, generation, i);
+        breed(i, random, bits.data());
+      }
+    };
+    const int nbShards{(nbPairs + _SHARD_PAIRS - 1) / _SHARD_PAIRS};
+    if (f_pool) {
+      f_pool->run(nbShards, shard);
+    } else {
+      for (int s = 0; s < nbShards; ++s)
+        shard(s, 0);
+    }
+  }
+  ++generation;
+
+  // The spare slots left, then the ones of the dropped chromosomes
+  std::copy(ranking.begin() + elitism_idx, ranking.end(), spare.begin());
+  std::swap(population, new_population);
+}
+
+template void GeneticPopulation::mutate<LinearSelection>(const int,
+                                                         ThreadPool *);
+template void GeneticPopulation::mutate<BinarySearchSelection>(const int,
+                                                               ThreadPool *);
+template void GeneticPopulation::mutate<AliasSelection>(const int,
+                                                        ThreadPool *);
+template void GeneticPopulation::mutate<TournamentSelection>(const int,
+                                                             ThreadPool *);
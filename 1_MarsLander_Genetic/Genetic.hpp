@@ -1,125 +1,536 @@
-#ifndef GENETIC_HPP
-#define GENETIC_HPP
-
-#include "Rocket.hpp"
-
-// #######################################################
-//
-//                       GLOBALS
-//
-// #######################################################
-
-constexpr int _CHROMOSOME_SIZE{200}; //!< Amount of gene per chromosome.
-constexpr int _POPULATION_SIZE{100}; //!< Amount of chromosome per population.
-
-constexpr double _ELITISM_RATIO{0.1}; //!< Elitism rate.
-constexpr double _MUTATION_RATE{0.2}; //!< Mutation rate.
-constexpr int _ELITISM_IDX{static_cast<int>(
-    _ELITISM_RATIO * _POPULATION_SIZE)}; //!< Idx of the last elitism selection.
-
-// #######################################################
-//
-//                        GENE
-//
-// #######################################################
-
-//! @brief  Gene struct
-struct Gene {
-  std::int8_t angle;  //!< Angle: clamped between -15 and 15.
-  std::int8_t thrust; //!< Thrust power: clamped between -1 and 1.
-
-  //! @brief  C'tor.
-  //!
-  //! @param[in] f_angle  Angle. Default is 0.
-  //! @param[in] f_thrust Thrust power. Default is 0.
-  Gene(const std::int8_t f_angle = 0, const std::int8_t f_thrust = 0);
-};
-
-// #######################################################
-//
-//                      CHROMOSOME
-//
-// #######################################################
-
-//! @brief  Chromosome struct
-struct Chromosome {
-  Gene chromosome[_CHROMOSOME_SIZE]; //!< Genes of the chromosomes.
-  double fitness;                    //!< Fitness score of the chromosome.
-
-  //! @brief  C'tor.
-  //!
-  //! @param[in] f_angle  Initial angle of the genes. Default is 0.
-  //! @param[in] f_thrust Initial thrust power of the genes. Default is 0.
-  Chromosome(const int f_angle = 0, const int f_thrust = 0);
-
-  //! @brief  Get a pointer to the i-th gene of the chromosome.
-  //!
-  //! @param[in] i The index of the gene.
-  //!
-  //! @ return A pointer to the gene.
-  Gene* getGene(const std::uint8_t i);
-  const Gene* getGene(const std::uint8_t i)const;
-
-  //! @brief  Sort method for the STL sort function.
-  static bool chromosome_sorter(Chromosome const &lhs, Chromosome const &rhs);
-};
-
-// #######################################################
-//
-//                      POPULATION
-//
-// #######################################################
-
-//! @brief  Population class
-class GeneticPopulation {
-public:
-  //! @brief  C'tor.
-  //!
-  //! @param[in] f_rocket       Initial rocket.
-  //! @param[in] f_floor_buffer Floor buffer data.
-  //! @param[in] f_size_floor   Size of the floor buffer.
-  GeneticPopulation(const Rocket &f_rocket, const int *f_floor_buffer,
-                    const int f_size_floor);
-
-  //! @brief  Initialize all the rocket with the initial rocket.
-  void initRockets();
-
-  //! @brief  Initialize all the chromosomes with some random values
-  void initChromosomes();
-
-  //! @brief  Get a pointer to the i-th chromosome of the population.
-  //!
-  //! @param[in] i The index of the chromosome.
-  //!
-  //! @ return A pointer to the chromosome.
-  Chromosome *getChromosome(const std::uint8_t i);
-
-  //! @brief  Get a pointer to the i-th rocket of the population.
-  //!
-  //! @param[in] i The index of the rocket.
-  //!
-  //! @ return A pointer to the rocket.
-  Rocket *getRocket(const std::uint8_t i);
-
-  //! @brief  Perform the mutation on the whole population.
-  //!
-  //! @param[in] idxStart  Incremental index where to start the mutation.
-  void mutate(const int idxStart);
-
-  Rocket rocket_save;  //!< Initial rocket.
-  int landing_zone_id; //!< ID of the landing_zone among the floor segments.
-
-private:
-  Chromosome populationA[_POPULATION_SIZE]; //!< A population of chromosome.
-  Chromosome populationB[_POPULATION_SIZE]; //!< A population of chromosome.
-
-  Chromosome *population;     //!< Pointer to the current population.
-  Chromosome *new_population; //!< Pointer to the next population.
-
-  Rocket rockets_gen[_POPULATION_SIZE]; //!< Rockets of the population.
-
-  const int *floor_buffer; //!< Floor buffer data.
-  const int size_floor;    //!< Size of the floor buffer data.
-};
-
-#endif
+#ifndef GENETIC_HPP
+#define GENETIC_HPP
+
+#include <vector>
+
+#include "GeneticConfig.hpp"
+#include "Random.hpp"
+#include "Rocket.hpp"
+#include "Selection.hpp"
+
+struct LevelGeometry;
+class DistanceField;
+class ThreadPool;
+
+// #######################################################
+//
+//                        GENE
+//
+// #######################################################
+
+//! @brief  Gene struct
+struct Gene {
+  std::int8_t angle;  //!< Angle: clamped between -15 and 15.
+  std::int8_t thrust; //!< Thrust power: clamped between -1 and 1.
+
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_angle  Angle. Default is 0.
+  //! @param[in] f_thrust Thrust power. Default is 0.
+  Gene(const std::int8_t f_angle = 0, const std::int8_t f_thrust = 0);
+};
+
+constexpr int _GENE_ALIGN{64}; //!< Alignment of the rows of genes, in bytes:
+                               //!< a cache line.
+
+//! @brief  View of the genes of a chromosome: a row of a `GeneMatrix`, or the
+//!         own genes of a chromosome. The interface of the `std::vector` it
+//!         stands for.
+struct GeneRow {
+  Gene *genes{nullptr}; //!< First gene.
+  int count{0};         //!< Number of genes.
+
+  Gene *data() { return genes; }
+  const Gene *data() const { return genes; }
+  std::size_t size() const { return static_cast<std::size_t>(count); }
+  Gene *begin() { return genes; }
+  Gene *end() { return genes + count; }
+  const Gene *begin() const { return genes; }
+  const Gene *end() const { return genes + count; }
+  Gene &operator[](const int i) { return genes[i]; }
+  const Gene &operator[](const int i) const { return genes[i]; }
+};
+
+//! @brief  Genes of the chromosomes of a population, in a single block.
+//!
+//! A row per chromosome, every row starting on its own cache line: a
+//! chromosome streams through memory, and the chromosomes of a population
+//! stay close, instead of a block per chromosome scattered on the heap.
+class GeneMatrix {
+public:
+  //! @brief  C'tor. Every gene keeps the angle and the thrust power.
+  //!
+  //! @param[in] f_rows  Number of rows: of chromosomes.
+  //! @param[in] f_cols  Number of genes per row.
+  GeneMatrix(const int f_rows, const int f_cols);
+
+  GeneMatrix(const GeneMatrix &) = delete;
+  GeneMatrix &operator=(const GeneMatrix &) = delete;
+
+  //! @brief  Get the i-th row.
+  //!
+  //! @param[in] i The index of the row.
+  //!
+  //! @return A view of the row.
+  GeneRow row(const int i);
+
+  const int cols;   //!< Genes per row.
+  const int stride; //!< Genes from a row to the next one, padded to
+                    //!< `_GENE_ALIGN` bytes.
+
+private:
+  std::vector<Gene> storage; //!< The rows, and room for the alignment.
+  Gene *first;               //!< First gene of the first row, aligned.
+};
+
+// #######################################################
+//
+//                      CHROMOSOME
+//
+// #######################################################
+
+//! @brief  Chromosome struct
+//!
+//! The chromosomes of a population are views of the rows of its
+//! `GeneMatrix`. Any other chromosome, a copy included, owns its genes.
+//!
+//! The genes are a ring: the gene i of the flight, from the first one, is in
+//! the slot i modulo the size. As the incremental search plays the genes, the
+//! slot of the gene played takes the gene at the end of the horizon: the
+//! chromosome always holds the `size()` genes from the next one to play.
+struct Chromosome {
+  GeneRow chromosome; //!< Genes of the chromosomes.
+  double fitness;     //!< Fitness score of the chromosome.
+
+  Rocket rocket;      //!< Rocket scored by `fitness`, at its last evaluation.
+  int evaluated_from; //!< Incremental index of its last evaluation, -1 if
+                      //!< its genes changed since.
+
+  //! @brief  C'tor. Every gene keeps the angle and the thrust power.
+  //!
+  //! @param[in] f_size  Number of genes. Default is `_CHROMOSOME_SIZE`.
+  explicit Chromosome(const int f_size = _CHROMOSOME_SIZE);
+
+  //! @brief  C'tor. Random genes.
+  //!
+  //! @param[in,out] f_random  The random generator.
+  //! @param[in]     f_angle   Initial angle of the genes.
+  //! @param[in]     f_thrust  Initial thrust power of the genes.
+  //! @param[in]     f_size    Number of genes. Default is `_CHROMOSOME_SIZE`.
+  Chromosome(Random &f_random, const int f_angle, const int f_thrust,
+             const int f_size = _CHROMOSOME_SIZE);
+
+  //! @brief  C'tor. A view of a row of genes, owned by a `GeneMatrix`.
+  //!
+  //! @param[in] f_row  The row.
+  explicit Chromosome(const GeneRow &f_row);
+
+  //! @brief  Copy c'tor. The copy owns its genes.
+  //!
+  //! @param[in] f_other  The chromosome to copy.
+  Chromosome(const Chromosome &f_other);
+
+  Chromosome(Chromosome &&) = default;
+
+  //! @brief  Copy the genes, the fitness and the evaluation of a chromosome.
+  //!         A view keeps its row, of the same size: the genes are copied
+  //!         into it.
+  //!
+  //! @param[in] f_other  The chromosome to copy.
+  //!
+  //! @return This chromosome.
+  Chromosome &operator=(const Chromosome &f_other);
+
+  //! @brief  Get the number of genes.
+  //!
+  //! @return The number of genes.
+  int size() const;
+
+  //! @brief  Get a pointer to the i-th gene of the flight, in its slot of
+  //!         the ring.
+  //!
+  //! @param[in] i The index of the gene, from the first one of the flight.
+  //!
+  //! @ return A pointer to the gene.
+  Gene* getGene(const int i);
+  const Gene* getGene(const int i)const;
+
+  //! @brief  Sort method for the STL sort function.
+  static bool chromosome_sorter(Chromosome const &lhs, Chromosome const &rhs);
+
+private:
+  std::vector<Gene> own; //!< Own genes, empty for a view.
+};
+
+// #######################################################
+//
+//                      CROSSOVER
+//
+// #######################################################
+
+//! @brief  Breed two children from two parents, gene after gene, with AVX2
+//!         lanes when available: 8 genes at once, both children in one pass.
+//!
+//! A gene is mutated when its weight w, the high 16 bits of its random
+//! value, is at most `f_threshold`: it takes the random angle and thrust
+//! power. Else it blends the parents, w / 65536 of the first one and the rest
+//! of the second one for the first child, the other way round for the second
+//! child, truncated. The blend is exact in float, so the lanes give the very
+//! same genes as `crossoverGenesScalar`.
+//!
+//! @param[in]  f_parent1, f_parent2  Genes of the parents.
+//! @param[out] f_child1, f_child2    Genes of the children. `f_child2` may be
+//!                                   nullptr, for an odd last child.
+//! @param[in]  f_size                Number of genes.
+//! @param[in]  f_bits                5 blocks of `f_size` random values: the
+//!                                   weights, then the angles and the thrust
+//!                                   powers of the first child, then of the
+//!                                   second one, bounded by their ranges.
+//! @param[in]  f_threshold           Weight of a mutated gene at most.
+//! @param[in]  f_angle_offset        Subtracted from the random angles.
+//! @param[in]  f_thrust_offset       Subtracted from the random thrust
+//!                                   powers.
+void crossoverGenes(const Gene *f_parent1, const Gene *f_parent2,
+                    Gene *f_child1, Gene *f_child2, const int f_size,
+                    const std::uint32_t *f_bits, const int f_threshold,
+                    const int f_angle_offset, const int f_thrust_offset);
+
+//! @brief  Same as `crossoverGenes`, one gene at a time: the reference of the
+//!         lanes.
+void crossoverGenesScalar(const Gene *f_parent1, const Gene *f_parent2,
+                          Gene *f_child1, Gene *f_child2, const int f_size,
+                          const std::uint32_t *f_bits, const int f_threshold,
+                          const int f_angle_offset,
+                          const int f_thrust_offset);
+
+// #######################################################
+//
+//                     PACKED GENES
+//
+// #######################################################
+
+//! @brief  Gene packed in a byte: the angle + 15 in the low 5 bits, the
+//!         thrust power + 1 in the next 2 bits. Half the size of a `Gene`.
+using PackedGene = std::uint8_t;
+
+constexpr int _PACKED_ANGLE_BIAS{15};  //!< Added to the packed angles.
+constexpr int _PACKED_THRUST_BIAS{1};  //!< Added to the packed thrusts.
+constexpr int _PACKED_THRUST_SHIFT{5}; //!< First bit of the thrust power.
+
+//! @brief  Pack a gene.
+//!
+//! @param[in] f_gene  The gene, within the ranges of `Gene`.
+//!
+//! @return The packed gene.
+inline PackedGene packGene(const Gene &f_gene) {
+  return static_cast<PackedGene>(
+      (f_gene.angle + _PACKED_ANGLE_BIAS) |
+      (f_gene.thrust + _PACKED_THRUST_BIAS) << _PACKED_THRUST_SHIFT);
+}
+
+//! @brief  Unpack a gene.
+//!
+//! @param[in] f_packed  The packed gene.
+//!
+//! @return The gene.
+inline Gene unpackGene(const PackedGene f_packed) {
+  const int angle{f_packed & 0x1F};
+  const int thrust{f_packed >> _PACKED_THRUST_SHIFT & 0x3};
+  return Gene(static_cast<std::int8_t>(angle - _PACKED_ANGLE_BIAS),
+              static_cast<std::int8_t>(thrust - _PACKED_THRUST_BIAS));
+}
+
+//! @brief  Pack genes, with AVX2 lanes when available: 16 genes at once.
+//!
+//! @param[in]  f_genes   The genes, within the ranges of `Gene`.
+//! @param[out] f_packed  The packed genes.
+//! @param[in]  f_size    Number of genes.
+void packGenes(const Gene *f_genes, PackedGene *f_packed, const int f_size);
+
+//! @brief  Unpack genes, with AVX2 lanes when available: 16 genes at once.
+//!
+//! @param[in]  f_packed  The packed genes.
+//! @param[out] f_genes   The genes.
+//! @param[in]  f_size    Number of genes.
+void unpackGenes(const PackedGene *f_packed, Gene *f_genes, const int f_size);
+
+//! @brief  Genes of chromosomes packed, a byte per gene: the chromosomes at
+//!         rest, in half the memory of a `GeneMatrix`.
+//!
+//! A row per chromosome, every row starting on its own cache line. The
+//! chromosomes go in and out whole, unpacked by `unpack`: `Chromosome`, and
+//! everything which reads its genes, stays as is.
+class PackedGeneMatrix {
+public:
+  //! @brief  C'tor. Every gene keeps the angle and the thrust power.
+  //!
+  //! @param[in] f_rows  Number of rows: of chromosomes.
+  //! @param[in] f_cols  Number of genes per row.
+  PackedGeneMatrix(const int f_rows, const int f_cols);
+
+  PackedGeneMatrix(const PackedGeneMatrix &) = delete;
+  PackedGeneMatrix &operator=(const PackedGeneMatrix &) = delete;
+
+  //! @brief  Get the i-th row.
+  //!
+  //! @param[in] i The index of the row.
+  //!
+  //! @return A pointer to the first packed gene of the row.
+  PackedGene *row(const int i);
+  const PackedGene *row(const int i) const;
+
+  //! @brief  Pack the genes of a chromosome into the i-th row.
+  //!
+  //! @param[in] i             The index of the row.
+  //! @param[in] f_chromosome  The chromosome, of `cols` genes.
+  void pack(const int i, const Chromosome &f_chromosome);
+
+  //! @brief  Unpack the i-th row into the genes of a chromosome. Its
+  //!         evaluation is dropped.
+  //!
+  //! @param[in]  i             The index of the row.
+  //! @param[out] f_chromosome  The chromosome, of `cols` genes.
+  void unpack(const int i, Chromosome &f_chromosome) const;
+
+  const int cols;   //!< Genes per row.
+  const int stride; //!< Packed genes from a row to the next one, padded to
+                    //!< `_GENE_ALIGN` bytes.
+
+private:
+  std::vector<PackedGene> storage; //!< The rows, and room for the alignment.
+  PackedGene *first;               //!< First gene of the first row, aligned.
+};
+
+// #######################################################
+//
+//                      POPULATION
+//
+// #######################################################
+
+//! @brief  Population class
+class GeneticPopulation {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_rocket    Initial rocket.
+  //! @param[in] f_geometry  Geometry of the level.
+  //! @param[in] f_field     Geodesic distance field of the level, to score
+  //!                        the crashes with. Default is nullptr, the
+  //!                        distance along the floor.
+  //! @param[in] f_seed      Seed of the random generator. Default is
+  //!                        `_RANDOM_SEED`.
+  //! @param[in] f_config    Dimensions and rates. Default is the compile
+  //!                        time constants.
+  GeneticPopulation(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+                    const DistanceField *f_field = nullptr,
+                    const std::uint64_t f_seed = _RANDOM_SEED,
+                    const GeneticConfig &f_config = GeneticConfig());
+
+  //! @brief  Initialize all the rocket with the initial rocket.
+  void initRockets();
+
+  //! @brief  Initialize all the chromosomes with some random values
+  void initChromosomes();
+
+  //! @brief  Get a pointer to the i-th chromosome of the population.
+  //!
+  //! @param[in] i The index of the chromosome.
+  //!
+  //! @ return A pointer to the chromosome.
+  Chromosome *getChromosome(const int i);
+
+  //! @brief  Get a pointer to the i-th rocket of the population.
+  //!
+  //! @param[in] i The index of the rocket.
+  //!
+  //! @ return A pointer to the rocket.
+  Rocket *getRocket(const int i);
+
+  //! @brief  Whether or not the i-th chromosome keeps its evaluation: its
+  //!         genes did not change since it was scored, from the same
+  //!         incremental index. Its rocket needs no new flight.
+  //!
+  //! The initial rocket `rocket_save` must only change with the incremental
+  //! index, as the incremental search does.
+  //!
+  //! @param[in] i         The index of the chromosome.
+  //! @param[in] idxStart  Incremental index of the next evaluation.
+  //!
+  //! @return True if evaluated, else false.
+  bool isEvaluated(const int i, const int idxStart) const;
+
+  //! @brief  Get the i-th fittest chromosome ranked by the last `mutate`.
+  //!
+  //! Only the `max(1, elitismIdx)` first ones are ranked.
+  //!
+  //! @param[in] i The rank of the chromosome.
+  //!
+  //! @return A pointer to the chromosome, nullptr if not ranked.
+  const Chromosome *getRanked(const int i) const;
+
+  //! @brief  Replace the genes of the i-th chromosome of the population,
+  //!         with the ones of a chromosome of another population. Its
+  //!         evaluation is dropped.
+  //!
+  //! @param[in] i        The index of the chromosome.
+  //! @param[in] f_genes  The `chromosome_size` new genes.
+  void setGenes(const int i, const Gene *f_genes);
+
+  //! @brief  Same as above, from packed genes.
+  //!
+  //! @param[in] i         The index of the chromosome.
+  //! @param[in] f_packed  The `chromosome_size` new genes, packed.
+  void setGenes(const int i, const PackedGene *f_packed);
+
+  //! @brief  Move the horizon of every chromosome one gene on, after the
+  //!         incremental search played a gene and moved `rocket_save`.
+  //!
+  //! The slot of the gene played takes a random gene, the last one of the
+  //! new horizon: a single gene per chromosome, whatever the size.
+  //!
+  //! @param[in] idxStart  Incremental index of the gene played.
+  void advance(const int idxStart);
+
+  //! @brief  Perform the mutation on the whole population.
+  //!
+  //! The rockets of the chromosomes still evaluated, see `isEvaluated`, are
+  //! the ones of their evaluation: they need not be flown again.
+  //!
+  //! @tparam Selection  Policy drawing the parents: `LinearSelection`,
+  //!                    `BinarySearchSelection`, `AliasSelection` or
+  //!                    `TournamentSelection`.
+  //!
+  //! The children are bred by `crossoverGenes`, over their whole ring: every
+  //! gene is still to play. All their random values are drawn at once
+  //! beforehand.
+  //!
+  //! In deterministic mode, every pair of children draws from its own
+  //! `CounterRandom` stream, keyed by the seed, the generation and the first
+  //! child: the pairs are bred in shards on the pool, and the children are
+  //! the same whatever the workers. Else the pairs are bred one after the
+  //! other from `rng`.
+  //!
+  //! @param[in] idxStart  Incremental index of the evaluations.
+  //! @param[in] f_pool    Workers of the deterministic mode. Default is
+  //!                      nullptr, the calling thread only.
+  template <class Selection = DefaultSelection>
+  void mutate(const int idxStart, ThreadPool *f_pool = nullptr);
+
+  Rocket rocket_save;  //!< Initial rocket.
+  int landing_zone_id; //!< ID of the landing_zone among the floor segments.
+
+  const GeneticConfig config; //!< Dimensions and rates.
+
+private:
+  //! @brief  Breed two children, gene after gene.
+  //!
+  //! @param[in]  f_parent1, f_parent2  The parents.
+  //! @param[out] f_child1, f_child2    The children. `f_child2` may be
+  //!                                   nullptr, for an odd last child.
+  //! @param[in]  f_bits                Random values of the genes, see
+  //!                                   `crossoverGenes`.
+  void crossover(const Chromosome &f_parent1, const Chromosome &f_parent2,
+                 Chromosome &f_child1, Chromosome *f_child2,
+                 const std::uint32_t *f_bits) const;
+
+  GeneMatrix genes; //!< Genes of the chromosomes, a row per slot.
+
+  //! Room for two populations. A chromosome never moves: the populations
+  //! are lists of slots, and an elite goes on to the next one by its slot.
+  std::vector<Chromosome> chromosomes;
+
+  std::vector<int> population;     //!< Slots of the current population.
+  std::vector<int> new_population; //!< Slots of the next population.
+  std::vector<int> spare;          //!< Slots out of the current population.
+  std::vector<int> ranking;        //!< Slots of the population, the elites
+                                   //!< first by decreasing fitness.
+  std::vector<double> fitness;     //!< Fitness of the slots of `ranking`.
+
+  std::vector<Rocket> rockets_gen; //!< Rockets of the population.
+
+  const LevelGeometry &geometry; //!< Geometry of the level.
+  const DistanceField *field;    //!< Distance field, nullptr if unused.
+
+  Random rng; //!< Random generator of the initialization and the mutations.
+
+  const std::uint64_t seed; //!< Key of the streams of the deterministic mode.
+  int generation;           //!< Mutations so far.
+};
+
+// #######################################################
+//
+//                       FITNESS
+//
+// #######################################################
+
+//! @brief  Given a rocket, compute its distance fitness score.
+//!
+//! The socre is calculated following the formulae:
+//!   f(d) = 1000. / (1 + 0.009999 * d)
+//!
+//!   f(0)      = 1000.000
+//!   f(10)     =  909.099
+//!   f(100)    =  500.025
+//!   f(1000)   =   90.917
+//!   f(10000)  =    9.902
+//!   f(100000) =    0.999
+//!
+//! @tparam Real  Scalar type of the rocket.
+//!
+//! The distance d goes straight from the crash to the end of the crashed
+//! segment, then along the floor to the landing zone.
+//!
+//! @param[in] rocket    The rocket, dead.
+//! @param[in] geometry  Geometry of the level.
+//!
+//! @return The distance fitness score.
+template <class Real>
+double distance(const BasicRocket<Real> &rocket,
+                const LevelGeometry &geometry);
+
+//! @brief  Same as above, with the geodesic distance d through the air from
+//!         the last position before the crash to the landing zone: the
+//!         caves no longer mislead the score.
+//!
+//! @tparam Real  Scalar type of the rocket.
+//!
+//! @param[in] rocket  The rocket, dead.
+//! @param[in] field   Distance field of the level.
+//!
+//! @return The distance fitness score.
+template <class Real>
+double distance(const BasicRocket<Real> &rocket, const DistanceField &field);
+
+//! @brief  Given horizontal and vertical speeds, compute the fitness penalty.
+//!
+//! The fitness penalty is calculated following the formulaes:
+//!   Horizontal speed: s >= 0 in m/s-1
+//!     h(s) = 0.00036057692307692 * s^2 + 0.069711538461538 * s
+//!            - 3.3653846153846
+//!
+//!     h(0)   = 3.3653846153846
+//!     h(40)  = 0
+//!     h(200) = -25
+//!     h(300) = -50
+//!
+//!   Vertical speed: s >= 0 in m/s-1
+//!     v(s) = 0.0003968253968254 * s ^ 2 + 0.051587301587302 * s
+//!            - 1.1904761904762
+//!
+//!     v(0)   = 1.1904761904762
+//!     v(25)  = 0
+//!     v(200) = -25
+//!     v(300) = -50
+//!
+//!   Speed fitness penalty: sx, sy >= 0 in m/s-1
+//!     f(sx, sy) = -5 * (h(sx) + v(sy))
+//!
+//! @tparam Real  Scalar type of the speeds.
+//!
+//! @param[in] vx  The horizontal speed.
+//! @param[in] vy  The vertical speed.
+//!
+//! @return The speed fitness penalty.
+template <class Real> double speed(const Real vx, const Real vy);
+
+#endif
@@ -0,0 +1,167 @@
+// Include standard headers
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "GeneticConfig.hpp"
+
+//! @brief  Read a whole text as a single value.
+//!
+//! @tparam T  Type of the value.
+//!
+//! @param[in]  f_text   The text.
+//! @param[out] f_value  The value.
+//!
+//! @return True if the text is exactly one value, else false.
+template <class T> bool readValue(const std::string &f_text, T &f_value) {
+  std::istringstream in(f_text);
+  in >> f_value;
+  if (in.fail())
+    return false;
+  in >> std::ws;
+  return in.eof();
+}
+
+/************************************************************/
+int GeneticConfig::elitismIdx() const {
+  return static_cast<int>(elitism_ratio * population_size);
+}
+
+/************************************************************/
+bool GeneticConfig::isGeneDue(const double f_timer, const int f_generations,
+                              const double f_elapsed) const {
+  if (f_timer <= 0.)
+    return false;
+
+  // The generations in deterministic mode: the wall time depends on the
+  // machine
+  return deterministic ? f_generations >= gene_generations
+                       : f_elapsed > f_timer;
+}
+
+/************************************************************/
+bool GeneticConfig::set(const std::string &f_key, const std::string &f_value,
+                        std::string &f_error) {
+  bool isRead{false};
+  if (f_key == "chromosome_size") {
+    isRead = readValue(f_value, chromosome_size);
+  } else if (f_key == "population_size") {
+    isRead = readValue(f_value, population_size);
+  } else if (f_key == "elitism_ratio") {
+    isRead = readValue(f_value, elitism_ratio);
+  } else if (f_key == "mutation_rate") {
+    isRead = readValue(f_value, mutation_rate);
+  } else if (f_key == "nb_threads") {
+    isRead = readValue(f_value, nb_threads);
+  } else if (f_key == "nb_islands") {
+    isRead = readValue(f_value, nb_islands);
+  } else if (f_key == "migration_interval") {
+    isRead = readValue(f_value, migration_interval);
+  } else if (f_key == "migration_size") {
+    isRead = readValue(f_value, migration_size);
+  } else if (f_key == "migration_topology") {
+    std::string topology;
+    isRead = readValue(f_value, topology) &&
+             (topology == "ring" || topology == "random");
+    if (isRead)
+      migration_topology =
+          topology == "ring" ? Topology::Ring : Topology::Random;
+  } else if (f_key == "seed") {
+    isRead = readValue(f_value, seed);
+  } else if (f_key == "deterministic") {
+    isRead = readValue(f_value, deterministic);
+  } else if (f_key == "gene_generations") {
+    isRead = readValue(f_value, gene_generations);
+  } else {
+    f_error = "Unknown key '" + f_key + "'";
+    return false;
+  }
+
+  if (!isRead)
+    f_error = "Wrong value '" + f_value + "' for '" + f_key + "'";
+  return isRead;
+}
+
+/************************************************************/
+bool GeneticConfig::load(const std::string &f_fileName,
+                         std::string &f_error) {
+  std::ifstream in_file(f_fileName);
+  if (!in_file.is_open()) {
+    f_error = "Cannot open '" + f_fileName + "'";
+    return false;
+  }
+
+  GeneticConfig config{*this};
+  std::string line;
+  for (int nbLine = 1; std::getline(in_file, line); ++nbLine) {
+    line = line.substr(0, line.find('#'));
+    if (line.find_first_not_of(" \t\r") == std::string::npos)
+      continue;
+
+    const std::size_t equal{line.find('=')};
+    std::string key;
+    if (equal == std::string::npos || !readValue(line.substr(0, equal), key)) {
+      f_error = "Expected 'key = value'";
+    } else if (config.set(key, line.substr(equal + 1), f_error)) {
+      continue;
+    }
+    f_error = f_fileName + ":" + std::to_string(nbLine) + ": " + f_error;
+    return false;
+  }
+
+  if (!config.isValid(f_error))
+    return false;
+  *this = config;
+  return true;
+}
+
+/************************************************************/
+bool GeneticConfig::parse(const int argc, const char *const *argv,
+                          std::string &f_error) {
+  GeneticConfig config{*this};
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg{argv[i]};
+    if (arg.compare(0, 2, "--") != 0 || i + 1 == argc) {
+      f_error = "Expected '--key value', got '" + arg + "'";
+      return false;
+    }
+
+    const std::string value{argv[++i]};
+    if (arg == "--config" ? !config.load(value, f_error)
+                          : !config.set(arg.substr(2), value, f_error))
+      return false;
+  }
+
+  if (!config.isValid(f_error))
+    return false;
+  *this = config;
+  return true;
+}
+
+/************************************************************/
+bool GeneticConfig::isValid(std::string &f_error) const {
+  if (chromosome_size < 1) {
+    f_error = "The chromosome size should be >= 1";
+  } else if (population_size < 2) {
+    f_error = "The population size should be >= 2";
+  } else if (elitism_ratio < 0. || elitism_ratio > 1. ||
+             elitismIdx() >= population_size) {
+    f_error = "The elitism ratio should leave children to breed";
+  } else if (mutation_rate < 0. || mutation_rate > 1.) {
+    f_error = "The mutation rate should be in [0, 1]";
+  } else if (nb_threads < 0) {
+    f_error = "The amount of thread should be >= 0";
+  } else if (nb_islands < 1 || migration_interval < 1) {
+    f_error = "The islands and the migration interval should be >= 1";
+  } else if (migration_size < 0 ||
+             migration_size > std::max(1, elitismIdx()) ||
+             migration_size >= population_size - elitismIdx()) {
+    f_error = "The migrants should be among the elites, and leave children "
+              "to breed";
+  } else if (gene_generations < 1) {
+    f_error = "The generations between two genes should be >= 1";
+  } else {
+    return true;
+  }
+  return false;
+}
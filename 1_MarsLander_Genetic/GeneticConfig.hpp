@@ -0,0 +1,126 @@
+#ifndef GENETIC_CONFIG_HPP
+#define GENETIC_CONFIG_HPP
+
+#include <cstdint>
+#include <string>
+
+constexpr int _CHROMOSOME_SIZE{200}; //!< Default amount of gene per chromosome.
+constexpr int _POPULATION_SIZE{100}; //!< Default amount of chromosome per
+                                     //!< population.
+
+constexpr double _ELITISM_RATIO{0.1}; //!< Default elitism rate.
+constexpr double _MUTATION_RATE{0.2}; //!< Default mutation rate.
+
+constexpr int _NB_THREADS{0}; //!< Default amount of thread, 0 for one per
+                              //!< hardware thread.
+
+constexpr int _NB_ISLANDS{1};          //!< Default amount of island.
+constexpr int _MIGRATION_INTERVAL{20}; //!< Default generations between two
+                                       //!< migrations.
+constexpr int _MIGRATION_SIZE{2};      //!< Default amount of migrant.
+
+constexpr int _GENE_GENERATIONS{20}; //!< Default generations between two
+                                     //!< genes of the incremental search, in
+                                     //!< deterministic mode.
+
+//! @brief  Destination of the migrants of an island.
+enum class Topology {
+  Ring,  //!< The next island, the last one sending to the first one.
+  Random //!< Any other island, drawn at every migration.
+};
+
+//! @brief  Dimensions and rates of the genetic algorithm, set at runtime.
+//!
+//! The defaults are the compile time constants above. A configuration file
+//! holds one `key = value` per line, `#` starting a comment; the command line
+//! takes the same keys as `--key value`, and `--config file` loads a file.
+//! The keys are `chromosome_size`, `population_size`, `elitism_ratio`,
+//! `mutation_rate`, `nb_threads`, `nb_islands`, `migration_interval`,
+//! `migration_size`, `migration_topology`, `ring` or `random`, `seed`,
+//! `deterministic`, `0` or `1`, and `gene_generations`.
+struct GeneticConfig {
+  int chromosome_size{_CHROMOSOME_SIZE}; //!< Amount of gene per chromosome.
+  int population_size{_POPULATION_SIZE}; //!< Amount of chromosome per
+                                         //!< population.
+  double elitism_ratio{_ELITISM_RATIO};  //!< Elitism rate.
+  double mutation_rate{_MUTATION_RATE};  //!< Mutation rate.
+  int nb_threads{_NB_THREADS};           //!< Threads evaluating the
+                                         //!< population, 0 for all.
+
+  int nb_islands{_NB_ISLANDS};                 //!< Populations evolving
+                                               //!< apart, 1 for none.
+  int migration_interval{_MIGRATION_INTERVAL}; //!< Generations between two
+                                               //!< migrations.
+  int migration_size{_MIGRATION_SIZE};         //!< Fittest chromosomes sent
+                                               //!< at every migration.
+  Topology migration_topology{Topology::Ring}; //!< Destination of the
+                                               //!< migrants.
+
+  std::uint64_t seed{0};                   //!< Seed of the search, 0 for a
+                                           //!< new one from the clock.
+  bool deterministic{false};               //!< The same seed gives the same
+                                           //!< solution, whatever the
+                                           //!< threads.
+  int gene_generations{_GENE_GENERATIONS}; //!< Deterministic mode:
+                                           //!< generations between two genes
+                                           //!< of the incremental search.
+
+  //! @brief  Get the index of the first chromosome after the elitism
+  //!         selection.
+  //!
+  //! @return The index.
+  int elitismIdx() const;
+
+  //! @brief  Whether the incremental search plays its next gene: every
+  //!         `gene_generations` generations in deterministic mode, else once
+  //!         the timer elapsed. Never without a timer.
+  //!
+  //! @param[in] f_timer        Timer of the incremental search, in s. 0 to
+  //!                           disable it.
+  //! @param[in] f_generations  Generations since the last gene played.
+  //! @param[in] f_elapsed      Time since the last gene played, in s.
+  //!
+  //! @return True to play the next gene.
+  bool isGeneDue(const double f_timer, const int f_generations,
+                 const double f_elapsed) const;
+
+  //! @brief  Set one value.
+  //!
+  //! @param[in]  f_key    Name of the value.
+  //! @param[in]  f_value  The value, as text.
+  //! @param[out] f_error  Reason of the failure, if any.
+  //!
+  //! @return True on success, else false and nothing is changed.
+  bool set(const std::string &f_key, const std::string &f_value,
+           std::string &f_error);
+
+  //! @brief  Set the values of a configuration file.
+  //!
+  //! @param[in]  f_fileName  Name of the file.
+  //! @param[out] f_error     Reason of the failure, if any.
+  //!
+  //! @return True on success, else false.
+  bool load(const std::string &f_fileName, std::string &f_error);
+
+  //! @brief  Set the values of the command line.
+  //!
+  //! @param[in]  argc     Number of arguments, the program name included.
+  //! @param[in]  argv     The arguments.
+  //! @param[out] f_error  Reason of the failure, if any.
+  //!
+  //! @return True on success, else false.
+  bool parse(const int argc, const char *const *argv, std::string &f_error);
+
+  //! @brief  Check that the population can breed: at least two chromosomes,
+  //!         one gene, rates in [0, 1] and room left after the elitism;
+  //!         that the amount of thread is not negative; that the migrants
+  //!         are among the elites, and leave children to breed; and that
+  //!         the incremental search plays its genes.
+  //!
+  //! @param[out] f_error  Reason of the failure, if any.
+  //!
+  //! @return True if valid, else false.
+  bool isValid(std::string &f_error) const;
+};
+
+#endif
@@ -0,0 +1,53 @@
+// Include standard headers
+#include <algorithm>
+#include <cmath>
+
+#include "LevelGeometry.hpp"
+
+/************************************************************/
+LevelGeometry::LevelGeometry(const int *f_floor_buffer, const int f_size_floor)
+    : size_floor{f_size_floor}, landing_zone_id{-1}, points(f_size_floor),
+      segments(f_size_floor), boxes(f_size_floor),
+      arc_from_start(f_size_floor, 0.), arc_to_end(f_size_floor, 0.) {
+  for (int i = 0; i < size_floor; ++i) {
+    points[i] = {static_cast<double>(f_floor_buffer[2 * i + 0]),
+                 static_cast<double>(f_floor_buffer[2 * i + 1])};
+  }
+
+  bounds = {points[0].x, points[0].x, points[0].y, points[0].y};
+  for (int k = 1; k < size_floor; ++k) {
+    const Coord_d &p1{points[k - 1]};
+    const Coord_d &p2{points[k]};
+    segments[k] = {p1, p2};
+    boxes[k] = {std::min(p1.x, p2.x), std::max(p1.x, p2.x),
+                std::min(p1.y, p2.y), std::max(p1.y, p2.y)};
+    bounds = {std::min(bounds.min_x, boxes[k].min_x),
+              std::max(bounds.max_x, boxes[k].max_x),
+              std::min(bounds.min_y, boxes[k].min_y),
+              std::max(bounds.max_y, boxes[k].max_y)};
+
+    // Statements constraints: Only 1 landing zone
+    if (landing_zone_id == -1 && p1.y == p2.y)
+      landing_zone_id = k;
+
+    arc_from_start[k] = arc_from_start[k - 1] +
+                        std::sqrt((p2.x - p1.x) * (p2.x - p1.x) +
+                                  (p2.y - p1.y) * (p2.y - p1.y));
+  }
+  for (int i = 0; i < size_floor; ++i)
+    arc_to_end[i] = arc_from_start[size_floor - 1] - arc_from_start[i];
+}
+
+/************************************************************/
+const Coord_d &LevelGeometry::towardLanding(const int f_floorId) const {
+  return points[f_floorId < landing_zone_id ? f_floorId : f_floorId - 1];
+}
+
+/************************************************************/
+double LevelGeometry::arcToLanding(const int f_floorId) const {
+  // Left of the landing zone, up to its first point; right of it, back to
+  // its last point
+  if (f_floorId < landing_zone_id)
+    return arc_from_start[landing_zone_id - 1] - arc_from_start[f_floorId];
+  return arc_to_end[landing_zone_id] - arc_to_end[f_floorId - 1];
+}
@@ -0,0 +1,53 @@
+#ifndef LEVEL_GEOMETRY_HPP
+#define LEVEL_GEOMETRY_HPP
+
+#include <vector>
+
+#include "Utils.hpp"
+
+//! @brief  Axis aligned bounding box.
+struct Box {
+  double min_x, max_x; //!< Abscissas.
+  double min_y, max_y; //!< Ordinates.
+};
+
+//! @brief  Geometry of the floor of a level, computed once from the raw floor
+//!         buffer and shared by the collisions, the fitness and the rendering.
+//!
+//! The segment k goes from the point k - 1 to the point k, for k in
+//! [1, size_floor - 1]: the index 0 of `segments` and `boxes` is unused.
+struct LevelGeometry {
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_floor_buffer  Floor buffer data.
+  //! @param[in] f_size_floor    Size of the floor buffer, in points.
+  LevelGeometry(const int *f_floor_buffer, const int f_size_floor);
+
+  //! @brief  Get the end of a segment on the side of the landing zone.
+  //!
+  //! @param[in] f_floorId  ID of the segment, not the landing zone.
+  //!
+  //! @return The point.
+  const Coord_d &towardLanding(const int f_floorId) const;
+
+  //! @brief  Get the length of the floor from `towardLanding(f_floorId)` to
+  //!         the landing zone, in O(1) with the arc lengths.
+  //!
+  //! @param[in] f_floorId  ID of the segment, not the landing zone.
+  //!
+  //! @return The length.
+  double arcToLanding(const int f_floorId) const;
+
+  int size_floor;      //!< Number of points.
+  int landing_zone_id; //!< ID of the landing zone among the segments.
+
+  std::vector<Coord_d> points;  //!< Points of the floor.
+  std::vector<Line_d> segments; //!< Segments, indexed by ID.
+  std::vector<Box> boxes;       //!< Bounding boxes of the segments.
+  Box bounds;                   //!< Bounding box of the whole floor.
+
+  std::vector<double> arc_from_start; //!< Floor length from the first point.
+  std::vector<double> arc_to_end;     //!< Floor length to the last point.
+};
+
+#endif
@@ -0,0 +1,18 @@
+#include "Physics.hpp"
+
+constexpr AccelerationTable TablePhysics::values;
+
+/************************************************************/
+const AccelerationTable &TrigPhysics::table() {
+  static const AccelerationTable table{[]() {
+    AccelerationTable res;
+    for (int angle = -90; angle <= 90; ++angle) {
+      for (int thrust = 0; thrust < _NB_THRUSTS; ++thrust) {
+        acceleration(angle, thrust, res.ax[accelerationIdx(angle, thrust)],
+                     res.ay[accelerationIdx(angle, thrust)]);
+      }
+    }
+    return res;
+  }()};
+  return table;
+}
@@ -0,0 +1,116 @@
+#ifndef PHYSICS_HPP
+#define PHYSICS_HPP
+
+#include <cmath>
+
+constexpr double _g{-3.711};                   //!< Gravity, in m/s-2
+constexpr double _PI{3.14159265358979323846}; //!< Same value as M_PI.
+
+constexpr int _NB_ANGLES{181}; //!< Angles, from -90 to 90 degrees.
+constexpr int _NB_THRUSTS{5};  //!< Thrust powers, from 0 to 4.
+
+//! @brief  Index of an (angle, thrust power) couple in an AccelerationTable.
+//!
+//! @param[in] angle   The angle, in [-90, 90].
+//! @param[in] thrust  The thrust power, in [0, 4].
+//!
+//! @return The index.
+constexpr int accelerationIdx(const int angle, const int thrust) {
+  return (angle + 90) * _NB_THRUSTS + thrust;
+}
+
+//! @brief  Compile time sine, for x in [-PI / 2, PI / 2].
+//!
+//! Taylor series evaluated with the Horner scheme, accurate to the last bits.
+//!
+//! @param[in] x  The angle, in radians.
+//!
+//! @return sin(x).
+constexpr double constexprSin(const double x) {
+  double res{1.};
+  for (int n = 12; n > 0; --n) {
+    res = 1. - x * x / ((2. * n) * (2. * n + 1.)) * res;
+  }
+  return x * res;
+}
+
+//! @brief  Compile time cosine, for x in [-PI / 2, PI / 2].
+//!
+//! @param[in] x  The angle, in radians.
+//!
+//! @return cos(x).
+constexpr double constexprCos(const double x) {
+  double res{1.};
+  for (int n = 12; n > 0; --n) {
+    res = 1. - x * x / ((2. * n - 1.) * (2. * n)) * res;
+  }
+  return res;
+}
+
+//! @brief  Accelerations of every (angle, thrust power) couple, gravity
+//!         included:
+//!           acc.x = power * sin(-angle)
+//!           acc.y = power * cos(angle) + _g
+struct AccelerationTable {
+  double ax[_NB_ANGLES * _NB_THRUSTS]; //!< Horizontal accelerations.
+  double ay[_NB_ANGLES * _NB_THRUSTS]; //!< Vertical accelerations.
+
+  //! @brief  C'tor. Fills the table at compile time.
+  constexpr AccelerationTable() : ax{}, ay{} {
+    for (int angle = -90; angle <= 90; ++angle) {
+      const double angle_rad{-angle * _PI / 180.};
+      const double s{constexprSin(angle_rad)};
+      const double c{constexprCos(angle_rad)};
+      for (int thrust = 0; thrust < _NB_THRUSTS; ++thrust) {
+        ax[accelerationIdx(angle, thrust)] = thrust * s;
+        ay[accelerationIdx(angle, thrust)] = thrust * c + _g;
+      }
+    }
+  }
+};
+
+//! @brief  Physics policy computing the accelerations with sin and cos.
+//!
+//! The reference: the historical behaviour of `Rocket::updateRocket`.
+struct TrigPhysics {
+  //! @brief  Get the accelerations of an (angle, thrust power) couple.
+  //!
+  //! @param[in]  angle   The angle, in [-90, 90].
+  //! @param[in]  thrust  The thrust power, in [0, 4].
+  //! @param[out] ax, ay  The accelerations.
+  static void acceleration(const int angle, const int thrust, double &ax,
+                           double &ay) {
+    const double angle_rad{-angle * _PI / 180.};
+    ax = thrust * std::sin(angle_rad);
+    ay = thrust * std::cos(angle_rad) + _g;
+  }
+
+  //! @brief  Get the same accelerations for every couple, for the batched
+  //!         simulators. Computed on first use.
+  //!
+  //! @return The table.
+  static const AccelerationTable &table();
+};
+
+//! @brief  Physics policy reading the accelerations from a compile time table.
+//!
+//! No transcendental call at all. The compile time sin and cos may differ
+//! from the ones of the standard library on the last bit.
+struct TablePhysics {
+  static constexpr AccelerationTable values{}; //!< The accelerations.
+
+  //! @brief  Same as `TrigPhysics::acceleration`.
+  static void acceleration(const int angle, const int thrust, double &ax,
+                           double &ay) {
+    ax = values.ax[accelerationIdx(angle, thrust)];
+    ay = values.ay[accelerationIdx(angle, thrust)];
+  }
+
+  //! @brief  Same as `TrigPhysics::table`.
+  static const AccelerationTable &table() { return values; }
+};
+
+//! Physics policy of the simulators when none is given.
+using DefaultPhysics = TablePhysics;
+
+#endif
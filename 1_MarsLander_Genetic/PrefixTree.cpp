@@ -0,0 +1,116 @@
+// Include standard headers
+#include <algorithm>
+#include <cstring>
+
+#include "PrefixTree.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+/************************************************************/
+bool PrefixTree::Edge::operator==(const Edge &f_other) const {
+  return parent == f_other.parent && genes[0] == f_other.genes[0] &&
+         genes[1] == f_other.genes[1];
+}
+
+/************************************************************/
+std::size_t PrefixTree::EdgeHash::operator()(const Edge &f_edge) const {
+  // Multiply-xorshift mix of the three words
+  std::uint64_t h{static_cast<std::uint64_t>(f_edge.parent)};
+  for (const std::uint64_t word : f_edge.genes) {
+    h = (h ^ word) * 0x9e3779b97f4a7c15;
+    h ^= h >> 32;
+  }
+  return static_cast<std::size_t>(h);
+}
+
+/************************************************************/
+PrefixTree::Edge PrefixTree::edge(const int f_parent, const Gene *f_gene) {
+  static_assert(sizeof(Gene) * _PREFIX_BLOCK == sizeof(Edge::genes),
+                "An edge packs _PREFIX_BLOCK genes in 16 bytes");
+  Edge e;
+  e.parent = f_parent;
+  std::memcpy(e.genes, f_gene, sizeof(e.genes));
+  return e;
+}
+
+/************************************************************/
+PrefixTree::PrefixTree(const FloorIndex &f_floor_index)
+    : nb_steps{0}, nb_shared_steps{0}, floor_index{f_floor_index},
+      idxStart{0} {}
+
+/************************************************************/
+void PrefixTree::reset(const Rocket &f_rocket, const int f_idxStart) {
+  idxStart = f_idxStart;
+  nodes.clear();
+  children.clear();
+  nodes.push_back({f_rocket, {-1, -1}});
+}
+
+/************************************************************/
+Collision PrefixTree::fly(const Chromosome &f_chromosome, Rocket &f_rocket) {
+  // The ring unrolled, from the slot of the first gene
+  const int n{f_chromosome.size()};
+  const GeneRow &ring{f_chromosome.chromosome};
+  const int slot{idxStart % n};
+  unrolled.resize(n);
+  std::rotate_copy(ring.begin(), ring.begin() + slot, ring.end(),
+                   unrolled.begin());
+  const Gene *genes{unrolled.data()};
+
+  // Follow the known prefix, as long as the rocket flies
+  int node{0};
+  int k{0};
+  while (nodes[node].collision.step == -1 && k + _PREFIX_BLOCK <= n) {
+    const auto child{children.find(edge(node, &genes[k]))};
+    if (child == children.end())
+      break;
+    node = child->second;
+    k += _PREFIX_BLOCK;
+  }
+
+  // Then fly, a new node at the end of every whole block
+  f_rocket = nodes[node].rocket;
+  Collision collision{nodes[node].collision};
+  const int shared{collision.step == -1 ? k : collision.step};
+  while (collision.step == -1 && k < n) {
+    const int block_start{k};
+    const int block_end{std::min(n, k + _PREFIX_BLOCK)};
+    for (; collision.step == -1 && k < block_end; ++k) {
+      f_rocket.updateRocket(genes[k].angle, genes[k].thrust);
+      if (f_rocket.x < 0 || f_rocket.x > _w || f_rocket.y < 0 ||
+          f_rocket.y > _h) {
+        collision = {k + 1, -1};
+      } else {
+        const int floor_id{floor_index.firstIntersection(
+            {{f_rocket.pX, f_rocket.pY}, {f_rocket.x, f_rocket.y}},
+            &floor_counters)};
+        if (floor_id != -1)
+          collision = {k + 1, floor_id};
+      }
+    }
+
+    if (block_end - block_start == _PREFIX_BLOCK) {
+      children.emplace(edge(node, &genes[block_start]),
+                       static_cast<int>(nodes.size()));
+      node = static_cast<int>(nodes.size());
+      nodes.push_back({f_rocket, collision});
+    }
+  }
+
+  nb_steps += collision.step == -1 ? n : collision.step;
+  nb_shared_steps += shared;
+  return collision;
+}
+
+/************************************************************/
+double PrefixTree::getSharedRate() const {
+  return nb_steps == 0 ? 0. : static_cast<double>(nb_shared_steps) / nb_steps;
+}
+
+/************************************************************/
+void PrefixTree::resetCounters() {
+  nb_steps = 0;
+  nb_shared_steps = 0;
+  floor_counters = FloorCounters();
+}
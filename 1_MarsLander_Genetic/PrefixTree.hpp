@@ -0,0 +1,99 @@
+#ifndef PREFIX_TREE_HPP
+#define PREFIX_TREE_HPP
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "FloorIndex.hpp"
+#include "Genetic.hpp"
+#include "Rocket.hpp"
+#include "Trajectory.hpp"
+
+constexpr int _PREFIX_BLOCK{8}; //!< Genes per edge of `PrefixTree`.
+
+//! @brief  Trie of the gene prefixes flown during a generation.
+//!
+//! An edge holds `_PREFIX_BLOCK` genes, a node the rocket at the end of the
+//! prefix from the root, and its first collision if any. A chromosome follows
+//! the known prefix of its genes, then flies from the rocket of the deepest
+//! node reached, forking new nodes. Every distinct prefix is then flown once
+//! per generation. The edges are exact gene contents, not hashes: the results
+//! are the very same as flying every chromosome on its own.
+class PrefixTree {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_floor_index  The floor of the level.
+  explicit PrefixTree(const FloorIndex &f_floor_index);
+
+  //! @brief  Forget every prefix, and start again from a rocket.
+  //!
+  //! @param[in] f_rocket    The initial rocket, at the root.
+  //! @param[in] f_idxStart  Index of the first gene of the prefixes.
+  void reset(const Rocket &f_rocket, const int f_idxStart);
+
+  //! @brief  Fly a chromosome, from `f_idxStart` to its first collision or
+  //!         to the end of its horizon, as `StepEngine::simulate` then
+  //!         `stepCollision` do.
+  //!
+  //! @param[in]  f_chromosome  The chromosome.
+  //! @param[out] f_rocket      The rocket at the collision, or at the end.
+  //!
+  //! @return The first collision.
+  Collision fly(const Chromosome &f_chromosome, Rocket &f_rocket);
+
+  //! @brief  Get the share of the steps read from the tree instead of
+  //!         flown, since the last reset of the counters.
+  //!
+  //! @return The share, in [0, 1].
+  double getSharedRate() const;
+
+  //! @brief  Reset the counters of the steps.
+  void resetCounters();
+
+  long long nb_steps;           //!< Steps to the outcomes of the chromosomes.
+  long long nb_shared_steps;    //!< Steps among them read from the tree.
+  FloorCounters floor_counters; //!< Steps of the floor index, flown.
+
+private:
+  //! @brief  Node of the tree: the end of a prefix.
+  struct Node {
+    Rocket rocket;       //!< Rocket at the end of the prefix, or at its
+                         //!< collision.
+    Collision collision; //!< First collision within the prefix.
+  };
+
+  //! @brief  Edge of the tree: the node it comes from, and its genes.
+  struct Edge {
+    int parent;             //!< Index of the node it comes from.
+    std::uint64_t genes[2]; //!< Genes of the edge, packed.
+
+    //! @brief  Same parent and same genes.
+    bool operator==(const Edge &f_other) const;
+  };
+
+  //! @brief  Hash of the edges for `children`.
+  struct EdgeHash {
+    std::size_t operator()(const Edge &f_edge) const;
+  };
+
+  //! @brief  Get the edge of the `_PREFIX_BLOCK` genes from `f_gene`.
+  //!
+  //! @param[in] f_parent  Index of the node it comes from.
+  //! @param[in] f_gene    The first gene.
+  //!
+  //! @return The edge.
+  static Edge edge(const int f_parent, const Gene *f_gene);
+
+  const FloorIndex &floor_index; //!< The floor of the level.
+  int idxStart;                  //!< Index of the first gene of the prefixes.
+
+  std::vector<Gene> unrolled; //!< Genes of the chromosome flown, from the
+                              //!< first one of the flight.
+
+  std::vector<Node> nodes;                          //!< Nodes, root first.
+  std::unordered_map<Edge, int, EdgeHash> children; //!< Node of each edge.
+};
+
+#endif
@@ -0,0 +1,338 @@
+// Standard libraries
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RANDOM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RANDOM_SSE2
+#endif
+
+#include "Random.hpp"
+
+//! Polynomial of the 2^128 jump of xoshiro256.
+constexpr std::uint64_t _JUMP[4]{0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+//! Polynomial of the 2^192 jump of xoshiro256.
+constexpr std::uint64_t _LONG_JUMP[4]{0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+                                      0x77710069854ee241, 0x39109bb02acbe635};
+
+//! @brief  Rotate 64 bits to the left.
+//!
+//! @param[in] x  The bits.
+//! @param[in] k  The rotation, in ]0, 64[.
+//!
+//! @return The rotated bits.
+inline std::uint64_t rotl(const std::uint64_t x, const int k) {
+  return (x << k) | (x >> (64 - k));
+}
+
+//! @brief  Step a xoshiro256** stream.
+//!
+//! @param[in,out] s0, s1, s2, s3  The four words of the stream.
+//!
+//! @return The next 64 random bits.
+inline std::uint64_t xoshiro(std::uint64_t &s0, std::uint64_t &s1,
+                             std::uint64_t &s2, std::uint64_t &s3) {
+  const std::uint64_t result{rotl(s1 * 5, 7) * 9};
+  const std::uint64_t t{s1 << 17};
+  s2 ^= s0;
+  s3 ^= s1;
+  s1 ^= s2;
+  s0 ^= s3;
+  s2 ^= t;
+  s3 = rotl(s3, 45);
+  return result;
+}
+
+//! @brief  Advance a xoshiro256 stream with a jump polynomial.
+//!
+//! @param[in,out] s  The four words of the stream.
+//! @param[in]     f_polynomial  The jump polynomial.
+void jumpStream(std::uint64_t s[4], const std::uint64_t f_polynomial[4]) {
+  std::uint64_t j[4]{0, 0, 0, 0};
+  for (int w = 0; w < 4; ++w) {
+    for (int b = 0; b < 64; ++b) {
+      if (f_polynomial[w] & (std::uint64_t{1} << b)) {
+        for (int k = 0; k < 4; ++k)
+          j[k] ^= s[k];
+      }
+      xoshiro(s[0], s[1], s[2], s[3]);
+    }
+  }
+  std::copy(j, j + 4, s);
+}
+
+/************************************************************/
+Random::Random(const std::uint64_t f_seed) { seed(f_seed); }
+
+/************************************************************/
+void Random::seed(const std::uint64_t f_seed) {
+  // splitmix64: never an all zero state
+  std::uint64_t x{f_seed};
+  for (std::uint64_t &word : state) {
+    std::uint64_t z{x += 0x9e3779b97f4a7c15};
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    word = z ^ (z >> 31);
+  }
+  initLanes();
+}
+
+/************************************************************/
+void Random::initLanes() {
+  std::uint64_t s[4]{state[0], state[1], state[2], state[3]};
+  for (int k = 0; k < _RANDOM_LANES; ++k) {
+    jumpStream(s, _JUMP);
+    for (int w = 0; w < 4; ++w)
+      lanes[w][k] = s[w];
+  }
+  nb_spare = 0;
+}
+
+/************************************************************/
+std::uint64_t Random::next() {
+  return xoshiro(state[0], state[1], state[2], state[3]);
+}
+
+/************************************************************/
+double Random::uniform() { return (next() >> 11) * (1. / 9007199254740992.); }
+
+/************************************************************/
+int Random::bounded(const int f_bound) {
+  return toBounded(static_cast<std::uint32_t>(next() >> 32), f_bound);
+}
+
+/************************************************************/
+void Random::jump() {
+  jumpStream(state, _LONG_JUMP);
+  initLanes();
+}
+
+/************************************************************/
+Random Random::split() {
+  const Random other{*this};
+  jump();
+  return other;
+}
+
+#if defined(RANDOM_AVX2)
+//! @brief  Step the 4 lanes at once, see `xoshiro`.
+//!
+//! @param[in,out] s  The lanes, word after word.
+//! @param[out]    f_values  The 8 values: low then high bits of every lane.
+void stepLanes(std::uint64_t s[4][_RANDOM_LANES], std::uint32_t *f_values) {
+  __m256i s0{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s[0]))};
+  __m256i s1{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s[1]))};
+  __m256i s2{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s[2]))};
+  __m256i s3{_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s[3]))};
+
+  // rotl(s1 * 5, 7) * 9, the products as shifts and adds
+  const __m256i s1_5{_mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1)};
+  const __m256i rot{_mm256_or_si256(_mm256_slli_epi64(s1_5, 7),
+                                    _mm256_srli_epi64(s1_5, 57))};
+  const __m256i result{_mm256_add_epi64(_mm256_slli_epi64(rot, 3), rot)};
+
+  const __m256i t{_mm256_slli_epi64(s1, 17)};
+  s2 = _mm256_xor_si256(s2, s0);
+  s3 = _mm256_xor_si256(s3, s1);
+  s1 = _mm256_xor_si256(s1, s2);
+  s0 = _mm256_xor_si256(s0, s3);
+  s2 = _mm256_xor_si256(s2, t);
+  s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s[0]), s0);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s[1]), s1);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s[2]), s2);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s[3]), s3);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(f_values), result);
+}
+
+//! @brief  Map 8 random bits values to [0, f_bound), see `toBounded`.
+//!
+//! @param[in,out] f_values  The values.
+//! @param[in]     f_bound   The bound.
+void boundLanes(std::uint32_t *f_values, const int f_bound) {
+  const __m256i bound{_mm256_set1_epi32(f_bound)};
+  const __m256i bits{
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(f_values))};
+  // Products of the even values, then of the odd ones: keep the high halves
+  const __m256i even{_mm256_srli_epi64(_mm256_mul_epu32(bits, bound), 32)};
+  const __m256i odd{_mm256_mul_epu32(_mm256_srli_epi64(bits, 32), bound)};
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(f_values),
+                      _mm256_blend_epi32(even, odd, 0xAA));
+}
+#elif defined(RANDOM_SSE2)
+//! @brief  Step 2 lanes at once, see `xoshiro`.
+//!
+//! @param[in,out] s  The lanes, word after word.
+//! @param[in]     k  The first lane.
+//! @param[out]    f_values  The 4 values: low then high bits of every lane.
+void stepLanes(std::uint64_t s[4][_RANDOM_LANES], const int k,
+               std::uint32_t *f_values) {
+  __m128i s0{_mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[0][k]))};
+  __m128i s1{_mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[1][k]))};
+  __m128i s2{_mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[2][k]))};
+  __m128i s3{_mm_loadu_si128(reinterpret_cast<const __m128i *>(&s[3][k]))};
+
+  // rotl(s1 * 5, 7) * 9, the products as shifts and adds
+  const __m128i s1_5{_mm_add_epi64(_mm_slli_epi64(s1, 2), s1)};
+  const __m128i rot{
+      _mm_or_si128(_mm_slli_epi64(s1_5, 7), _mm_srli_epi64(s1_5, 57))};
+  const __m128i result{_mm_add_epi64(_mm_slli_epi64(rot, 3), rot)};
+
+  const __m128i t{_mm_slli_epi64(s1, 17)};
+  s2 = _mm_xor_si128(s2, s0);
+  s3 = _mm_xor_si128(s3, s1);
+  s1 = _mm_xor_si128(s1, s2);
+  s0 = _mm_xor_si128(s0, s3);
+  s2 = _mm_xor_si128(s2, t);
+  s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[0][k]), s0);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[1][k]), s1);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[2][k]), s2);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(&s[3][k]), s3);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(f_values), result);
+}
+
+//! @brief  Map 4 random bits values to [0, f_bound), see `toBounded`.
+//!
+//! @param[in,out] f_values  The values.
+//! @param[in]     f_bound   The bound.
+void boundLanes(std::uint32_t *f_values, const int f_bound) {
+  const __m128i bound{_mm_set1_epi32(f_bound)};
+  const __m128i high{_mm_set_epi32(-1, 0, -1, 0)};
+  const __m128i bits{
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(f_values))};
+  // Products of the even values, then of the odd ones: keep the high halves
+  const __m128i even{_mm_srli_epi64(_mm_mul_epu32(bits, bound), 32)};
+  const __m128i odd{_mm_mul_epu32(_mm_srli_epi64(bits, 32), bound)};
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i *>(f_values),
+      _mm_or_si128(_mm_andnot_si128(high, even), _mm_and_si128(high, odd)));
+}
+#endif
+
+/************************************************************/
+void Random::fill(std::uint32_t *f_values, const int f_count) {
+  constexpr int step{2 * _RANDOM_LANES};
+  int i{0};
+
+  // The values left by the previous fill first
+  for (; nb_spare > 0 && i < f_count; ++i)
+    f_values[i] = spare[step - nb_spare--];
+
+  for (; i + step <= f_count; i += step) {
+#if defined(RANDOM_AVX2)
+    stepLanes(lanes, &f_values[i]);
+#elif defined(RANDOM_SSE2)
+    for (int k = 0; k < _RANDOM_LANES; k += 2)
+      stepLanes(lanes, k, &f_values[i + 2 * k]);
+#else
+    for (int k = 0; k < _RANDOM_LANES; ++k) {
+      const std::uint64_t bits{
+          xoshiro(lanes[0][k], lanes[1][k], lanes[2][k], lanes[3][k])};
+      f_values[i + 2 * k] = static_cast<std::uint32_t>(bits);
+      f_values[i + 2 * k + 1] = static_cast<std::uint32_t>(bits >> 32);
+    }
+#endif
+  }
+
+  // A last partial step: keep the rest for the next fill
+  if (i < f_count) {
+    fill(spare, step);
+    nb_spare = step;
+    for (; i < f_count; ++i)
+      f_values[i] = spare[step - nb_spare--];
+  }
+}
+
+/************************************************************/
+void Random::fillBounded(std::uint32_t *f_values, const int f_count,
+                         const int f_bound) {
+  fill(f_values, f_count);
+  int i{0};
+#if defined(RANDOM_AVX2)
+  for (; i + 8 <= f_count; i += 8)
+    boundLanes(&f_values[i], f_bound);
+#elif defined(RANDOM_SSE2)
+  for (; i + 4 <= f_count; i += 4)
+    boundLanes(&f_values[i], f_bound);
+#endif
+  for (; i < f_count; ++i)
+    f_values[i] = toBounded(f_values[i], f_bound);
+}
+
+//! Multipliers and key increments of the Philox4x32 rounds.
+constexpr std::uint32_t _PHILOX_M0{0xD2511F53}, _PHILOX_M1{0xCD9E8D57};
+constexpr std::uint32_t _PHILOX_W0{0x9E3779B9}, _PHILOX_W1{0xBB67AE85};
+constexpr int _PHILOX_ROUNDS{10}; //!< Rounds of a block.
+
+/************************************************************/
+CounterRandom::CounterRandom(const std::uint64_t f_seed,
+                             const std::uint32_t f_generation,
+                             const std::uint32_t f_chromosome)
+    : key{static_cast<std::uint32_t>(f_seed),
+          static_cast<std::uint32_t>(f_seed >> 32)},
+      counter{0, 0, f_generation, f_chromosome}, block{}, nb_block{0} {}
+
+/************************************************************/
+void CounterRandom::nextBlock() {
+  std::uint32_t x[4]{counter[0], counter[1], counter[2], counter[3]};
+  std::uint32_t k0{key[0]}, k1{key[1]};
+  for (int r = 0; r < _PHILOX_ROUNDS; ++r) {
+    const std::uint64_t p0{static_cast<std::uint64_t>(_PHILOX_M0) * x[0]};
+    const std::uint64_t p1{static_cast<std::uint64_t>(_PHILOX_M1) * x[2]};
+    const std::uint32_t y[4]{
+        static_cast<std::uint32_t>(p1 >> 32) ^ x[1] ^ k0,
+        static_cast<std::uint32_t>(p1),
+        static_cast<std::uint32_t>(p0 >> 32) ^ x[3] ^ k1,
+        static_cast<std::uint32_t>(p0)};
+    std::copy(y, y + 4, x);
+    k0 += _PHILOX_W0;
+    k1 += _PHILOX_W1;
+  }
+  std::copy(x, x + 4, block);
+  nb_block = 4;
+
+  // 64 bits of block index
+  if (++counter[0] == 0)
+    ++counter[1];
+}
+
+/************************************************************/
+std::uint64_t CounterRandom::next() {
+  std::uint32_t bits[2];
+  fill(bits, 2);
+  return static_cast<std::uint64_t>(bits[1]) << 32 | bits[0];
+}
+
+/************************************************************/
+double CounterRandom::uniform() {
+  return (next() >> 11) * (1. / 9007199254740992.);
+}
+
+/************************************************************/
+int CounterRandom::bounded(const int f_bound) {
+  return Random::toBounded(static_cast<std::uint32_t>(next() >> 32), f_bound);
+}
+
+/************************************************************/
+void CounterRandom::fill(std::uint32_t *f_values, const int f_count) {
+  for (int i = 0; i < f_count; ++i) {
+    if (nb_block == 0)
+      nextBlock();
+    f_values[i] = block[4 - nb_block--];
+  }
+}
+
+/************************************************************/
+void CounterRandom::fillBounded(std::uint32_t *f_values, const int f_count,
+                                const int f_bound) {
+  fill(f_values, f_count);
+  for (int i = 0; i < f_count; ++i)
+    f_values[i] = Random::toBounded(f_values[i], f_bound);
+}
@@ -0,0 +1,151 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+constexpr int _RANDOM_LANES{4}; //!< Interleaved streams of the bulk fills.
+constexpr std::uint64_t _RANDOM_SEED{42}; //!< Seed when none is given.
+
+//! @brief  Pseudo random number generator: xoshiro256**.
+//!
+//! Explicitly seeded, with no hidden global state: the same seed gives the
+//! same numbers, and every thread owns its generator, taken from another one
+//! with `split`.
+//!
+//! The bulk fills run `_RANDOM_LANES` more xoshiro256** streams, the main
+//! stream jumped 1 to `_RANDOM_LANES` times, with AVX2 or SSE2 lanes when
+//! available. The scalar fallback steps the very same streams: the values do
+//! not depend on the instruction set.
+class Random {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_seed  The seed. Default is `_RANDOM_SEED`.
+  explicit Random(const std::uint64_t f_seed = _RANDOM_SEED);
+
+  //! @brief  Restart the generator from a seed, expanded with splitmix64.
+  //!
+  //! @param[in] f_seed  The seed.
+  void seed(const std::uint64_t f_seed);
+
+  //! @brief  Get the next 64 random bits of the main stream.
+  //!
+  //! @return The random bits.
+  std::uint64_t next();
+
+  //! @brief  Get a random value in [0, 1), 53 bits.
+  //!
+  //! @return The random value.
+  double uniform();
+
+  //! @brief  Get a random integer in [0, f_bound), by Lemire's
+  //!         multiply-shift.
+  //!
+  //! @param[in] f_bound  The bound, > 0.
+  //!
+  //! @return The random integer.
+  int bounded(const int f_bound);
+
+  //! @brief  Map 32 random bits to [0, f_bound), as `bounded`.
+  //!
+  //! @param[in] f_bits   The random bits, from `fill` for instance.
+  //! @param[in] f_bound  The bound, > 0.
+  //!
+  //! @return The random integer.
+  static int toBounded(const std::uint32_t f_bits, const int f_bound) {
+    return static_cast<int>((static_cast<std::uint64_t>(f_bits) *
+                             static_cast<std::uint32_t>(f_bound)) >>
+                            32);
+  }
+
+  //! @brief  Map 32 random bits to [0, 1).
+  //!
+  //! @param[in] f_bits  The random bits.
+  //!
+  //! @return The random value.
+  static double toUniform(const std::uint32_t f_bits) {
+    return f_bits * (1. / 4294967296.);
+  }
+
+  //! @brief  Fill an array with random bits, from the lanes.
+  //!
+  //! @param[out] f_values  The array.
+  //! @param[in]  f_count   Number of values.
+  void fill(std::uint32_t *f_values, const int f_count);
+
+  //! @brief  Fill an array with random integers in [0, f_bound), from the
+  //!         lanes, mapped as `toBounded`.
+  //!
+  //! @param[out] f_values  The array.
+  //! @param[in]  f_count   Number of values.
+  //! @param[in]  f_bound   The bound, > 0.
+  void fillBounded(std::uint32_t *f_values, const int f_count,
+                   const int f_bound);
+
+  //! @brief  Advance the generator of 2^192 values of the main stream: the
+  //!         streams before and after do not overlap.
+  void jump();
+
+  //! @brief  Get an independent generator, for another thread: a copy of
+  //!         this one, which then jumps.
+  //!
+  //! @return The new generator.
+  Random split();
+
+private:
+  //! @brief  Derive the lanes from the main stream.
+  void initLanes();
+
+  std::uint64_t state[4];                 //!< Main stream.
+  std::uint64_t lanes[4][_RANDOM_LANES];  //!< Bulk streams, word after word.
+  std::uint32_t spare[2 * _RANDOM_LANES]; //!< Values of the last bulk step.
+  int nb_spare;                           //!< Unused values, at the end.
+};
+
+//! @brief  Counter-based pseudo random number generator: Philox4x32-10.
+//!
+//! The stream of a (seed, generation, chromosome) key is a pure function of
+//! it: the n-th values are the Philox rounds of the counter (n, generation,
+//! chromosome) with the seed as the key. Nothing is carried from one stream
+//! to another, so the streams can be drawn in any order, on any thread, and
+//! give the same values.
+class CounterRandom {
+public:
+  //! @brief  C'tor.
+  //!
+  //! @param[in] f_seed        The seed.
+  //! @param[in] f_generation  The generation.
+  //! @param[in] f_chromosome  The chromosome.
+  CounterRandom(const std::uint64_t f_seed, const std::uint32_t f_generation,
+                const std::uint32_t f_chromosome);
+
+  //! @brief  Same as `Random::next`.
+  std::uint64_t next();
+
+  //! @brief  Same as `Random::uniform`.
+  double uniform();
+
+  //! @brief  Same as `Random::bounded`.
+  int bounded(const int f_bound);
+
+  //! @brief  Fill an array with the next random bits of the stream.
+  //!
+  //! @param[out] f_values  The array.
+  //! @param[in]  f_count   Number of values.
+  void fill(std::uint32_t *f_values, const int f_count);
+
+  //! @brief  Same as `Random::fillBounded`, from the stream.
+  void fillBounded(std::uint32_t *f_values, const int f_count,
+                   const int f_bound);
+
+private:
+  //! @brief  Compute the 4 values of the counter, then increment it.
+  void nextBlock();
+
+  std::uint32_t key[2];     //!< The seed.
+  std::uint32_t counter[4]; //!< Block index, generation and chromosome.
+  std::uint32_t block[4];   //!< Values of the last block.
+  int nb_block;             //!< Unused values of the block, at the end.
+};
+
+#endif
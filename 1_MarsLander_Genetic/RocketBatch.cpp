@@ -0,0 +1,456 @@
+// Standard libraries
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ROCKET_BATCH_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ROCKET_BATCH_SSE2
+#endif
+
+#include "RocketBatch.hpp"
+
+extern const float _w; //!< Map width.
+
+//! @brief  Scalar version of the update, for a single slot of the batch.
+//!
+//! @param[out] b         The batch.
+//! @param[in]  table     The accelerations table.
+//! @param[in]  i         The index of the slot.
+//! @param[in]  f_angle   The angle request.
+//! @param[in]  f_thrust  The thrust power request.
+void updateSlot(RocketBatch &b, const AccelerationTable &table, const int i,
+                const std::int8_t f_angle, const std::int8_t f_thrust) {
+  if (!b.isAlive[i])
+    return;
+
+  b.pX[i] = b.x[i];
+  b.pY[i] = b.y[i];
+
+  b.angle[i] = std::min(90, std::max(-90, b.angle[i] + f_angle));
+  if (b.fuel[i] == 0) {
+    b.thrust[i] = 0;
+  } else {
+    b.thrust[i] = std::min(4, std::max(0, b.thrust[i] + f_thrust));
+  }
+  b.fuel[i] = std::max(0, b.fuel[i] - b.thrust[i]);
+
+  b.ax[i] = table.ax[accelerationIdx(b.angle[i], b.thrust[i])];
+  b.ay[i] = table.ay[accelerationIdx(b.angle[i], b.thrust[i])];
+
+  b.x[i] += 0.5 * b.ax[i] + b.vx[i];
+  b.y[i] += 0.5 * b.ay[i] + b.vy[i];
+  b.y[i] = std::max(0., b.y[i]);
+
+  b.vx[i] += b.ax[i];
+  b.vy[i] += b.ay[i];
+}
+
+//! @brief  Load 4 int8 requests as 4 int32.
+//!
+//! @param[in] f_requests  The 4 requests.
+//!
+//! @return The sign extended requests.
+#if defined(ROCKET_BATCH_AVX2) || defined(ROCKET_BATCH_SSE2)
+inline __m128i loadRequests(const std::int8_t *f_requests) {
+  std::int32_t packed;
+  std::memcpy(&packed, f_requests, sizeof(packed));
+#if defined(ROCKET_BATCH_AVX2)
+  return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+#else
+  const __m128i bytes{_mm_cvtsi32_si128(packed)};
+  const __m128i words{_mm_unpacklo_epi8(bytes, bytes)};
+  return _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 24);
+#endif
+}
+#endif
+
+#if defined(ROCKET_BATCH_SSE2)
+//! @brief  Select a where the mask is set, else b.
+inline __m128i select(const __m128i m, const __m128i a, const __m128i b) {
+  return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+}
+inline __m128d select(const __m128d m, const __m128d a, const __m128d b) {
+  return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+}
+
+//! @brief  Clamp the int32 lanes of v between lo and hi.
+inline __m128i clamp(const __m128i v, const __m128i lo, const __m128i hi) {
+  const __m128i v_lo{select(_mm_cmplt_epi32(v, lo), lo, v)};
+  return select(_mm_cmpgt_epi32(v_lo, hi), hi, v_lo);
+}
+
+//! @brief  Update the floating point state of 2 slots of the batch.
+//!
+//! @param[out] b         The batch.
+//! @param[in]  table     The accelerations table.
+//! @param[in]  i         The index of the first slot.
+//! @param[in]  alive     The 64 bits alive mask of the 2 slots.
+//! @param[in]  idx       The accelerations indexes of the 2 slots.
+inline void updatePair(RocketBatch &b, const AccelerationTable &table,
+                       const int i, const __m128d alive,
+                       const std::int32_t *idx) {
+  const __m128d half{_mm_set1_pd(0.5)};
+  const __m128d zero{_mm_setzero_pd()};
+
+  const __m128d ax{_mm_set_pd(table.ax[idx[1]], table.ax[idx[0]])};
+  const __m128d ay{_mm_set_pd(table.ay[idx[1]], table.ay[idx[0]])};
+
+  const __m128d x{_mm_load_pd(&b.x[i])};
+  const __m128d y{_mm_load_pd(&b.y[i])};
+  const __m128d vx{_mm_load_pd(&b.vx[i])};
+  const __m128d vy{_mm_load_pd(&b.vy[i])};
+
+  const __m128d nx{_mm_add_pd(x, _mm_add_pd(_mm_mul_pd(half, ax), vx))};
+  const __m128d ny{
+      _mm_max_pd(_mm_add_pd(y, _mm_add_pd(_mm_mul_pd(half, ay), vy)), zero)};
+
+  _mm_store_pd(&b.pX[i], select(alive, x, _mm_load_pd(&b.pX[i])));
+  _mm_store_pd(&b.pY[i], select(alive, y, _mm_load_pd(&b.pY[i])));
+  _mm_store_pd(&b.x[i], select(alive, nx, x));
+  _mm_store_pd(&b.y[i], select(alive, ny, y));
+  _mm_store_pd(&b.vx[i], select(alive, _mm_add_pd(vx, ax), vx));
+  _mm_store_pd(&b.vy[i], select(alive, _mm_add_pd(vy, ay), vy));
+  _mm_store_pd(&b.ax[i], select(alive, ax, _mm_load_pd(&b.ax[i])));
+  _mm_store_pd(&b.ay[i], select(alive, ay, _mm_load_pd(&b.ay[i])));
+}
+#endif
+
+/************************************************************/
+RocketBatch::RocketBatch() {
+  for (int i = 0; i < _BATCH_SIZE; ++i) {
+    pX[i] = pY[i] = x[i] = y[i] = 0.;
+    vx[i] = vy[i] = ax[i] = ay[i] = 0.;
+    angle[i] = thrust[i] = fuel[i] = 0;
+    isAlive[i] = 0;
+    floor_id_crash[i] = -1;
+    ids[i] = i;
+  }
+  count = 0;
+}
+
+/************************************************************/
+void *RocketBatch::operator new(const std::size_t f_size) {
+  // Room for the alignment, and for the pointer given by the global `new`
+  void *raw{::operator new(f_size + _BATCH_ALIGN + sizeof(void *))};
+  const std::uintptr_t aligned{
+      (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *) + _BATCH_ALIGN -
+       1) &
+      ~static_cast<std::uintptr_t>(_BATCH_ALIGN - 1)};
+  reinterpret_cast<void **>(aligned)[-1] = raw;
+  return reinterpret_cast<void *>(aligned);
+}
+
+/************************************************************/
+void RocketBatch::operator delete(void *f_ptr) {
+  if (f_ptr != nullptr)
+    ::operator delete(static_cast<void **>(f_ptr)[-1]);
+}
+
+/************************************************************/
+void RocketBatch::init(const Rocket &f_rocket, const int f_first,
+                       const int f_count) {
+  for (int i = 0; i < _BATCH_SIZE; ++i) {
+    pX[i] = f_rocket.x;
+    pY[i] = f_rocket.y;
+    x[i] = f_rocket.x;
+    y[i] = f_rocket.y;
+    vx[i] = f_rocket.vx;
+    vy[i] = f_rocket.vy;
+    ax[i] = f_rocket.ax;
+    ay[i] = f_rocket.ay;
+    angle[i] = f_rocket.angle;
+    thrust[i] = f_rocket.thrust;
+    fuel[i] = f_rocket.fuel;
+    isAlive[i] = i < f_count ? 1 : 0;
+    floor_id_crash[i] = -1;
+    ids[i] = f_first + i;
+  }
+  count = f_count;
+}
+
+/************************************************************/
+void RocketBatch::init(const Rocket &f_rocket, const int *f_ids,
+                       const int f_count) {
+  init(f_rocket, 0, f_count);
+  for (int i = 0; i < f_count; ++i)
+    ids[i] = f_ids[i];
+}
+
+/************************************************************/
+template <class Physics>
+void RocketBatch::updateRockets(const std::int8_t *f_angles,
+                                const std::int8_t *f_thrusts) {
+  const AccelerationTable &table{Physics::table()};
+
+  // The work list, rounded up to full lanes: the padding slots are dead
+  const int end{(count + _BATCH_LANES - 1) / _BATCH_LANES * _BATCH_LANES};
+
+  int i{0};
+#if defined(ROCKET_BATCH_AVX2)
+  const __m128i zero{_mm_setzero_si128()};
+  const __m128i minAngle{_mm_set1_epi32(-90)};
+  const __m128i maxAngle{_mm_set1_epi32(90)};
+  const __m128i maxThrust{_mm_set1_epi32(4)};
+  const __m128i idxOffset{_mm_set1_epi32(accelerationIdx(0, 0))};
+  const __m256d half{_mm256_set1_pd(0.5)};
+  const __m256d zero_pd{_mm256_setzero_pd()};
+
+  for (; i + 4 <= end; i += 4) {
+    const __m128i alive{_mm_cmpgt_epi32(
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&isAlive[i])), zero)};
+    if (_mm_movemask_epi8(alive) == 0)
+      continue;
+    const __m256d alive_pd{_mm256_castsi256_pd(_mm256_cvtepi32_epi64(alive))};
+
+    // Update angle, thrust power and fuel
+    const __m128i a0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&angle[i]))};
+    const __m128i t0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&thrust[i]))};
+    const __m128i f0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&fuel[i]))};
+
+    const __m128i a{_mm_min_epi32(
+        maxAngle,
+        _mm_max_epi32(minAngle, _mm_add_epi32(a0, loadRequests(&f_angles[i]))))};
+    const __m128i t{_mm_andnot_si128(
+        _mm_cmpeq_epi32(f0, zero),
+        _mm_min_epi32(maxThrust,
+                      _mm_max_epi32(zero, _mm_add_epi32(
+                                              t0, loadRequests(&f_thrusts[i])))))};
+    const __m128i f{_mm_max_epi32(zero, _mm_sub_epi32(f0, t))};
+
+    _mm_store_si128(reinterpret_cast<__m128i *>(&angle[i]),
+                    _mm_blendv_epi8(a0, a, alive));
+    _mm_store_si128(reinterpret_cast<__m128i *>(&thrust[i]),
+                    _mm_blendv_epi8(t0, t, alive));
+    _mm_store_si128(reinterpret_cast<__m128i *>(&fuel[i]),
+                    _mm_blendv_epi8(f0, f, alive));
+
+    // Update acceleration, speed and position
+    // idx = (angle + 90) * 5 + thrust
+    const __m128i idx{_mm_add_epi32(
+        _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(a, 2), a), t), idxOffset)};
+    const __m256d ax_pd{_mm256_i32gather_pd(table.ax, idx, 8)};
+    const __m256d ay_pd{_mm256_i32gather_pd(table.ay, idx, 8)};
+
+    const __m256d x_pd{_mm256_load_pd(&x[i])};
+    const __m256d y_pd{_mm256_load_pd(&y[i])};
+    const __m256d vx_pd{_mm256_load_pd(&vx[i])};
+    const __m256d vy_pd{_mm256_load_pd(&vy[i])};
+
+    const __m256d nx{_mm256_add_pd(
+        x_pd, _mm256_add_pd(_mm256_mul_pd(half, ax_pd), vx_pd))};
+    const __m256d ny{_mm256_max_pd(
+        _mm256_add_pd(y_pd,
+                      _mm256_add_pd(_mm256_mul_pd(half, ay_pd), vy_pd)),
+        zero_pd)};
+
+    _mm256_store_pd(&pX[i],
+                    _mm256_blendv_pd(_mm256_load_pd(&pX[i]), x_pd, alive_pd));
+    _mm256_store_pd(&pY[i],
+                    _mm256_blendv_pd(_mm256_load_pd(&pY[i]), y_pd, alive_pd));
+    _mm256_store_pd(&x[i], _mm256_blendv_pd(x_pd, nx, alive_pd));
+    _mm256_store_pd(&y[i], _mm256_blendv_pd(y_pd, ny, alive_pd));
+    _mm256_store_pd(&vx[i], _mm256_blendv_pd(
+                                vx_pd, _mm256_add_pd(vx_pd, ax_pd), alive_pd));
+    _mm256_store_pd(&vy[i], _mm256_blendv_pd(
+                                vy_pd, _mm256_add_pd(vy_pd, ay_pd), alive_pd));
+    _mm256_store_pd(&ax[i],
+                    _mm256_blendv_pd(_mm256_load_pd(&ax[i]), ax_pd, alive_pd));
+    _mm256_store_pd(&ay[i],
+                    _mm256_blendv_pd(_mm256_load_pd(&ay[i]), ay_pd, alive_pd));
+  }
+#elif defined(ROCKET_BATCH_SSE2)
+  const __m128i zero{_mm_setzero_si128()};
+  const __m128i minAngle{_mm_set1_epi32(-90)};
+  const __m128i maxAngle{_mm_set1_epi32(90)};
+  const __m128i maxThrust{_mm_set1_epi32(4)};
+  const __m128i idxOffset{_mm_set1_epi32(accelerationIdx(0, 0))};
+
+  alignas(16) std::int32_t idx[4];
+
+  for (; i + 4 <= end; i += 4) {
+    const __m128i alive{_mm_cmpgt_epi32(
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&isAlive[i])), zero)};
+    if (_mm_movemask_epi8(alive) == 0)
+      continue;
+
+    // Update angle, thrust power and fuel
+    const __m128i a0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&angle[i]))};
+    const __m128i t0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&thrust[i]))};
+    const __m128i f0{
+        _mm_load_si128(reinterpret_cast<const __m128i *>(&fuel[i]))};
+
+    const __m128i a{clamp(_mm_add_epi32(a0, loadRequests(&f_angles[i])),
+                          minAngle, maxAngle)};
+    const __m128i t{_mm_andnot_si128(
+        _mm_cmpeq_epi32(f0, zero),
+        clamp(_mm_add_epi32(t0, loadRequests(&f_thrusts[i])), zero,
+              maxThrust))};
+    const __m128i f_sub{_mm_sub_epi32(f0, t)};
+    const __m128i f{select(_mm_cmplt_epi32(f_sub, zero), zero, f_sub)};
+
+    _mm_store_si128(reinterpret_cast<__m128i *>(&angle[i]),
+                    select(alive, a, a0));
+    _mm_store_si128(reinterpret_cast<__m128i *>(&thrust[i]),
+                    select(alive, t, t0));
+    _mm_store_si128(reinterpret_cast<__m128i *>(&fuel[i]),
+                    select(alive, f, f0));
+
+    // Update acceleration, speed and position, 2 slots at a time
+    // idx = (angle + 90) * 5 + thrust
+    _mm_store_si128(reinterpret_cast<__m128i *>(idx),
+                    _mm_add_epi32(_mm_add_epi32(_mm_add_epi32(
+                                                    _mm_slli_epi32(a, 2), a),
+                                                t),
+                                  idxOffset));
+    updatePair(*this, table, i,
+               _mm_castsi128_pd(_mm_unpacklo_epi32(alive, alive)), &idx[0]);
+    updatePair(*this, table, i + 2,
+               _mm_castsi128_pd(_mm_unpackhi_epi32(alive, alive)), &idx[2]);
+  }
+#endif
+
+  for (; i < count; ++i) {
+    updateSlot(*this, table, i, f_angles[i], f_thrusts[i]);
+  }
+}
+
+template void RocketBatch::updateRockets<TrigPhysics>(const std::int8_t *,
+                                                      const std::int8_t *);
+template void RocketBatch::updateRockets<TablePhysics>(const std::int8_t *,
+                                                       const std::int8_t *);
+
+/************************************************************/
+void RocketBatch::compact() {
+  int alive{0};
+  for (int s = 0; s < count; ++s) {
+    if (isAlive[s]) {
+      if (s != alive)
+        swapSlots(s, alive);
+      alive++;
+    }
+  }
+  count = alive;
+}
+
+/************************************************************/
+void RocketBatch::reorder() {
+  compact();
+
+  double death[_BATCH_SIZE];
+  int order[_BATCH_SIZE];
+  for (int s = 0; s < count; ++s) {
+    death[s] = expectedDeath(s);
+    order[s] = s;
+  }
+  std::stable_sort(order, order + count, [&death](const int a, const int b) {
+    return death[a] > death[b];
+  });
+
+  // Apply the permutation, following where the swaps move the slots
+  int occupant[_BATCH_SIZE];
+  int position[_BATCH_SIZE];
+  for (int s = 0; s < count; ++s) {
+    occupant[s] = s;
+    position[s] = s;
+  }
+  for (int s = 0; s < count; ++s) {
+    const int from{position[order[s]]};
+    if (from == s)
+      continue;
+    swapSlots(s, from);
+    std::swap(occupant[s], occupant[from]);
+    position[occupant[s]] = s;
+    position[occupant[from]] = from;
+  }
+}
+
+/************************************************************/
+void RocketBatch::kill(const int s, const int f_floor_id_crash) {
+  isAlive[s] = 0;
+  floor_id_crash[s] = f_floor_id_crash;
+}
+
+/************************************************************/
+bool RocketBatch::isParamSuccess(const int s) const {
+  return std::abs(angle[s]) <= 15 && std::abs(vy[s]) <= 40 &&
+         std::abs(vx[s]) <= 20;
+}
+
+/************************************************************/
+void RocketBatch::getRocket(const int s, Rocket &f_rocket) const {
+  f_rocket.pX = pX[s];
+  f_rocket.pY = pY[s];
+  f_rocket.x = x[s];
+  f_rocket.y = y[s];
+  f_rocket.vx = vx[s];
+  f_rocket.vy = vy[s];
+  f_rocket.ax = ax[s];
+  f_rocket.ay = ay[s];
+  f_rocket.angle = static_cast<std::int8_t>(angle[s]);
+  f_rocket.thrust = static_cast<std::int8_t>(thrust[s]);
+  f_rocket.fuel = fuel[s];
+  f_rocket.isAlive = isAlive[s] != 0;
+  f_rocket.floor_id_crash = floor_id_crash[s];
+}
+
+/************************************************************/
+void RocketBatch::swapSlots(const int s1, const int s2) {
+  std::swap(pX[s1], pX[s2]);
+  std::swap(pY[s1], pY[s2]);
+  std::swap(x[s1], x[s2]);
+  std::swap(y[s1], y[s2]);
+  std::swap(vx[s1], vx[s2]);
+  std::swap(vy[s1], vy[s2]);
+  std::swap(ax[s1], ax[s2]);
+  std::swap(ay[s1], ay[s2]);
+  std::swap(angle[s1], angle[s2]);
+  std::swap(thrust[s1], thrust[s2]);
+  std::swap(fuel[s1], fuel[s2]);
+  std::swap(isAlive[s1], isAlive[s2]);
+  std::swap(floor_id_crash[s1], floor_id_crash[s2]);
+  std::swap(ids[s1], ids[s2]);
+}
+
+/************************************************************/
+double RocketBatch::expectedDeath(const int s) const {
+  double death{std::numeric_limits<double>::max()};
+
+  // Leaving the map by the sides
+  if (vx[s] < 0) {
+    death = x[s] / -vx[s];
+  } else if (vx[s] > 0) {
+    death = (_w - x[s]) / vx[s];
+  }
+
+  // Reaching the bottom of the map: 0.5 * ay * t^2 + vy * t + y = 0
+  const double a{0.5 * ay[s]};
+  if (a == 0.) {
+    if (vy[s] < 0)
+      death = std::min(death, y[s] / -vy[s]);
+  } else {
+    const double disc{vy[s] * vy[s] - 4. * a * y[s]};
+    if (disc >= 0) {
+      const double t1{(-vy[s] - std::sqrt(disc)) / (2. * a)};
+      const double t2{(-vy[s] + std::sqrt(disc)) / (2. * a)};
+      if (t1 > 0)
+        death = std::min(death, t1);
+      if (t2 > 0)
+        death = std::min(death, t2);
+    }
+  }
+
+  return death;
+}
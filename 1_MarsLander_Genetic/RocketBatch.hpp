@@ -0,0 +1,134 @@
+#ifndef ROCKET_BATCH_HPP
+#define ROCKET_BATCH_HPP
+
+#include <cstddef>
+
+#include "Genetic.hpp"
+#include "Rocket.hpp"
+
+constexpr int _BATCH_LANES{4}; //!< Widest SIMD lane count (AVX2 on doubles).
+constexpr int _BATCH_SIZE{(_POPULATION_SIZE + _BATCH_LANES - 1) /
+                          _BATCH_LANES *
+                          _BATCH_LANES}; //!< Default population padded to the
+                                         //!< lanes.
+constexpr int _REORDER_PERIOD{16}; //!< Steps between two reorderings.
+constexpr std::size_t _BATCH_ALIGN{32}; //!< Alignment of the arrays, in bytes.
+
+//! @brief  Structure-of-arrays holding the rockets of a whole population.
+//!
+//! The rocket of the slot s is the `ids[s]`-th rocket of the population. The
+//! alive rockets are kept within the first `count` slots by `compact` and
+//! `reorder`, so that `updateRockets` only runs on full lanes. The padding
+//! slots, after the rockets given to `init`, are never alive. A larger
+//! population runs by chunks of `_BATCH_SIZE` rockets.
+//! `updateRockets` advances every alive rocket of one gene step, with AVX2 or
+//! SSE2 lanes when available, and gives the very same values than
+//! `Rocket::updateRocket` with the same physics policy.
+struct RocketBatch {
+  alignas(32) double pX[_BATCH_SIZE]; //!< Previous X coordinates.
+  alignas(32) double pY[_BATCH_SIZE]; //!< Previous Y coordinates.
+  alignas(32) double x[_BATCH_SIZE];  //!< Current X coordinates.
+  alignas(32) double y[_BATCH_SIZE];  //!< Current Y coordinates.
+  alignas(32) double vx[_BATCH_SIZE]; //!< Horizontal velocities.
+  alignas(32) double vy[_BATCH_SIZE]; //!< Vertical velocities.
+  alignas(32) double ax[_BATCH_SIZE]; //!< Horizontal accelerations.
+  alignas(32) double ay[_BATCH_SIZE]; //!< Vertical accelerations.
+
+  alignas(32) std::int32_t angle[_BATCH_SIZE];   //!< Angles.
+  alignas(32) std::int32_t thrust[_BATCH_SIZE];  //!< Thrust powers.
+  alignas(32) std::int32_t fuel[_BATCH_SIZE];    //!< Remaining fuels.
+  alignas(32) std::int32_t isAlive[_BATCH_SIZE]; //!< 1 if alive, else 0.
+
+  int floor_id_crash[_BATCH_SIZE]; //!< ID of the floor where they crashed.
+
+  int ids[_BATCH_SIZE]; //!< Index, within the population, of the slots.
+  int count;            //!< Number of slots in the alive work list.
+
+  //! @brief  C'tor. Every slot is dead.
+  RocketBatch();
+
+  //! @brief  Allocate a batch on the heap, aligned on the lanes: the
+  //!         `alignas` of the arrays is not honored by the C++14 `new`.
+  //!
+  //! @param[in] f_size  Size of the batch.
+  //!
+  //! @return The aligned memory.
+  static void *operator new(const std::size_t f_size);
+
+  //! @brief  Free a batch allocated by `new`.
+  //!
+  //! @param[in] f_ptr  The aligned memory.
+  static void operator delete(void *f_ptr);
+
+  //! @brief  Re-init every rocket of the population with the same rocket.
+  //!
+  //! @param[in] f_rocket  The rocket to re-init the values with.
+  //! @param[in] f_first   Index, within the population, of the first rocket.
+  //!                      Default is 0.
+  //! @param[in] f_count   Number of rockets, at most `_BATCH_SIZE`. Default
+  //!                      is `_POPULATION_SIZE`.
+  void init(const Rocket &f_rocket, const int f_first = 0,
+            const int f_count = _POPULATION_SIZE);
+
+  //! @brief  Same as above, for any rockets of the population.
+  //!
+  //! @param[in] f_rocket  The rocket to re-init the values with.
+  //! @param[in] f_ids     Indexes, within the population, of the rockets.
+  //! @param[in] f_count   Number of rockets, at most `_BATCH_SIZE`.
+  void init(const Rocket &f_rocket, const int *f_ids, const int f_count);
+
+  //! @brief  Apply the next angle and thrust requests on every alive rocket
+  //!         of the work list.
+  //!
+  //! @tparam Physics  Policy giving the accelerations table: `TrigPhysics` or
+  //!                  `TablePhysics`.
+  //!
+  //! @param[in] f_angles   The angle requests, one per slot.
+  //! @param[in] f_thrusts  The thrust power requests, one per slot.
+  template <class Physics = DefaultPhysics>
+  void updateRockets(const std::int8_t *f_angles, const std::int8_t *f_thrusts);
+
+  //! @brief  Move the dead rockets out of the work list, keeping the order of
+  //!         the alive ones.
+  void compact();
+
+  //! @brief  Compact the work list, then sort it by expected death step, the
+  //!         longest living rockets first. The next deaths happen then at the
+  //!         end of the work list, where compacting them is cheap.
+  void reorder();
+
+  //! @brief  Kill the rocket of the slot s.
+  //!
+  //! @param[in] s                The slot of the rocket.
+  //! @param[in] f_floor_id_crash ID of the floor where it crashed, -1 if none.
+  void kill(const int s, const int f_floor_id_crash);
+
+  //! @brief  Whether or not the rocket of the slot s could land.
+  //!
+  //! @param[in] s  The slot of the rocket.
+  //!
+  //! @return Same as `Rocket::isParamSuccess`.
+  bool isParamSuccess(const int s) const;
+
+  //! @brief  Copy the rocket of the slot s into a scalar Rocket.
+  //!
+  //! @param[in]  s         The slot of the rocket.
+  //! @param[out] f_rocket  The rocket to fill.
+  void getRocket(const int s, Rocket &f_rocket) const;
+
+private:
+  //! @brief  Swap the content of two slots.
+  //!
+  //! @param[in] s1, s2  The slots to swap.
+  void swapSlots(const int s1, const int s2);
+
+  //! @brief  Number of steps before the rocket of the slot s leaves the map or
+  //!         reaches the bottom of it, if it keeps its acceleration.
+  //!
+  //! @param[in] s  The slot of the rocket.
+  //!
+  //! @return The expected death step, from now.
+  double expectedDeath(const int s) const;
+};
+
+#endif
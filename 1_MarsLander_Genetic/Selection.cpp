@@ -0,0 +1,151 @@
+// Include standard headers
+#include <algorithm>
+
+#include "Selection.hpp"
+
+//! @brief  Get the sum of the fitness.
+//!
+//! @param[in] f_fitness  Fitness of the chromosomes.
+//! @param[in] f_size     Number of chromosomes.
+//!
+//! @return The sum.
+double sumFitness(const double *f_fitness, const int f_size) {
+  double sum{0.};
+  for (int i = 0; i < f_size; ++i)
+    sum += f_fitness[i];
+  return sum;
+}
+
+/************************************************************/
+void LinearSelection::build(const double *f_fitness, const int f_size) {
+  const double sum_fitness{sumFitness(f_fitness, f_size)};
+  // Without any fitness, every chromosome is as likely
+  const bool uniform{sum_fitness <= 0.};
+  cumulative.resize(f_size);
+
+  double cum_sum{0.};
+  for (int i = f_size - 1; i >= 0; --i) {
+    cumulative[i] =
+        cum_sum + (uniform ? 1. / f_size : f_fitness[i] / sum_fitness);
+    cum_sum = cumulative[i];
+  }
+}
+
+/************************************************************/
+template <class Generator>
+int LinearSelection::draw(Generator &f_random) const {
+  const int size{static_cast<int>(cumulative.size())};
+  int idx{size};
+  while (idx == size) {
+    idx = 1;
+    const double choice{f_random.uniform()};
+    for (; idx < size; ++idx) {
+      if (cumulative[idx] < choice) {
+        idx--;
+        break;
+      }
+    }
+  }
+  return idx;
+}
+
+template int LinearSelection::draw<Random>(Random &) const;
+template int LinearSelection::draw<CounterRandom>(CounterRandom &) const;
+
+/************************************************************/
+void BinarySearchSelection::build(const double *f_fitness, const int f_size) {
+  // Without any fitness, every chromosome is as likely
+  const bool uniform{sumFitness(f_fitness, f_size) <= 0.};
+  cumulative.resize(f_size);
+
+  double cum_sum{0.};
+  for (int i = 0; i < f_size; ++i) {
+    cum_sum += uniform ? 1. : f_fitness[i];
+    cumulative[i] = cum_sum;
+  }
+}
+
+/************************************************************/
+template <class Generator>
+int BinarySearchSelection::draw(Generator &f_random) const {
+  const double choice{f_random.uniform() * cumulative.back()};
+  const int idx{static_cast<int>(
+      std::upper_bound(cumulative.begin(), cumulative.end(), choice) -
+      cumulative.begin())};
+  return std::min(idx, static_cast<int>(cumulative.size()) - 1);
+}
+
+template int BinarySearchSelection::draw<Random>(Random &) const;
+template int BinarySearchSelection::draw<CounterRandom>(CounterRandom &) const;
+
+/************************************************************/
+void AliasSelection::build(const double *f_fitness, const int f_size) {
+  const double sum_fitness{sumFitness(f_fitness, f_size)};
+  const bool uniform{sum_fitness <= 0.};
+  probability.resize(f_size);
+  alias.resize(f_size);
+  small.clear();
+  large.clear();
+
+  // Scaled probabilities: 1 on average
+  for (int i = 0; i < f_size; ++i) {
+    probability[i] = uniform ? 1. : f_fitness[i] * f_size / sum_fitness;
+    alias[i] = i;
+    if (probability[i] < 1.)
+      small.push_back(i);
+    else
+      large.push_back(i);
+  }
+
+  // Fill every small column up to 1 with a large one
+  while (!small.empty() && !large.empty()) {
+    const int s{small.back()};
+    const int l{large.back()};
+    small.pop_back();
+    alias[s] = l;
+    probability[l] += probability[s] - 1.;
+    if (probability[l] < 1.) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+
+  // Left overs, 1 up to the rounding errors
+  for (const int i : small)
+    probability[i] = 1.;
+  for (const int i : large)
+    probability[i] = 1.;
+}
+
+/************************************************************/
+template <class Generator>
+int AliasSelection::draw(Generator &f_random) const {
+  const int size{static_cast<int>(probability.size())};
+  const double x{f_random.uniform() * size};
+  const int column{std::min(static_cast<int>(x), size - 1)};
+  return x - column < probability[column] ? column : alias[column];
+}
+
+template int AliasSelection::draw<Random>(Random &) const;
+template int AliasSelection::draw<CounterRandom>(CounterRandom &) const;
+
+/************************************************************/
+void TournamentSelection::build(const double *f_fitness, const int f_size) {
+  fitness.assign(f_fitness, f_fitness + f_size);
+}
+
+/************************************************************/
+template <class Generator>
+int TournamentSelection::draw(Generator &f_random) const {
+  const int size{static_cast<int>(fitness.size())};
+  int best{f_random.bounded(size)};
+  for (int k = 1; k < _TOURNAMENT_SIZE; ++k) {
+    const int contestant{f_random.bounded(size)};
+    if (fitness[contestant] > fitness[best])
+      best = contestant;
+  }
+  return best;
+}
+
+template int TournamentSelection::draw<Random>(Random &) const;
+template int TournamentSelection::draw<CounterRandom>(CounterRandom &) const;
@@ -0,0 +1,91 @@
+#ifndef SELECTION_HPP
+#define SELECTION_HPP
+
+#include <vector>
+
+#include "Random.hpp"
+
+constexpr int _TOURNAMENT_SIZE{3}; //!< Contestants of a tournament.
+
+//! @brief  Selection policy scanning the cumulative fitness for every draw.
+//!
+//! The reference: the historical behaviour of `GeneticPopulation::mutate`.
+//! O(N) per draw, and the last chromosome is never drawn.
+struct LinearSelection {
+  //! @brief  Prepare the draws.
+  //!
+  //! @param[in] f_fitness  Fitness of the chromosomes, in any order, all
+  //!                       >= 0. All at 0, the draws are uniform.
+  //! @param[in] f_size     Number of chromosomes.
+  void build(const double *f_fitness, const int f_size);
+
+  //! @brief  Draw a chromosome, with a probability proportional to its
+  //!         fitness.
+  //!
+  //! @tparam Generator  `Random` or `CounterRandom`.
+  //!
+  //! @param[in,out] f_random  The random generator.
+  //!
+  //! @return Index of the chromosome.
+  template <class Generator> int draw(Generator &f_random) const;
+
+  std::vector<double> cumulative; //!< Fitness from the index to the end,
+                                  //!< normalized.
+};
+
+//! @brief  Selection policy searching the cumulative fitness by dichotomy.
+//!
+//! O(N) to build, O(log N) per draw.
+struct BinarySearchSelection {
+  //! @brief  Same as `LinearSelection::build`.
+  void build(const double *f_fitness, const int f_size);
+
+  //! @brief  Same as `LinearSelection::draw`, every chromosome included.
+  template <class Generator> int draw(Generator &f_random) const;
+
+  std::vector<double> cumulative; //!< Fitness from the start to the index,
+                                  //!< included.
+};
+
+//! @brief  Selection policy reading a Vose alias table.
+//!
+//! Every column holds its own chromosome with a probability, and an alias for
+//! the rest: one random value picks the column and the coin within.
+//! O(N) to build, O(1) per draw.
+struct AliasSelection {
+  //! @brief  Same as `LinearSelection::build`.
+  void build(const double *f_fitness, const int f_size);
+
+  //! @brief  Same as `BinarySearchSelection::draw`.
+  template <class Generator> int draw(Generator &f_random) const;
+
+  std::vector<double> probability; //!< Probability to keep the column.
+  std::vector<int> alias;          //!< Index drawn otherwise.
+  std::vector<int> small, large;   //!< Work lists of the build.
+};
+
+//! @brief  Selection policy keeping the fittest of `_TOURNAMENT_SIZE`
+//!         chromosomes drawn uniformly.
+//!
+//! Only the ranks matter, not the fitness values. O(1) per draw, nothing to
+//! build but a copy of the fitness.
+struct TournamentSelection {
+  //! @brief  Same as `LinearSelection::build`.
+  void build(const double *f_fitness, const int f_size);
+
+  //! @brief  Draw a chromosome, the fittest of a tournament.
+  //!
+  //! @tparam Generator  `Random` or `CounterRandom`.
+  //!
+  //! @param[in,out] f_random  The random generator.
+  //!
+  //! @return Index of the chromosome.
+  template <class Generator> int draw(Generator &f_random) const;
+
+  std::vector<double> fitness; //!< Fitness of the chromosomes.
+};
+
+//! Selection policy of `GeneticPopulation::mutate` when none is given.
+using DefaultSelection = AliasSelection;
+
+#endif
@@ -0,0 +1,160 @@
+// Include standard headers
+#include <algorithm>
+#include <cassert>
+
+#include "ThreadPool.hpp"
+
+constexpr int _RANGE_BITS{24}; //!< Bits of each bound of a range.
+constexpr std::uint64_t _RANGE_MASK{(std::uint64_t{1} << _RANGE_BITS) - 1};
+
+//! @brief  Pack a range: the low 16 bits of the run, its begin and its end.
+//!
+//! @param[in] f_run    Number of the run.
+//! @param[in] f_begin  First task of the range.
+//! @param[in] f_end    Task after the last one.
+//!
+//! @return The packed range.
+inline std::uint64_t pack(const std::uint64_t f_run, const int f_begin,
+                          const int f_end) {
+  return (f_run << (2 * _RANGE_BITS)) |
+         (static_cast<std::uint64_t>(f_begin) << _RANGE_BITS) |
+         static_cast<std::uint64_t>(f_end);
+}
+
+//! @brief  Get the run of a packed range, on its 16 bits.
+inline std::uint64_t runOf(const std::uint64_t f_bounds) {
+  return f_bounds >> (2 * _RANGE_BITS);
+}
+
+//! @brief  Get the first task of a packed range.
+inline int beginOf(const std::uint64_t f_bounds) {
+  return static_cast<int>((f_bounds >> _RANGE_BITS) & _RANGE_MASK);
+}
+
+//! @brief  Get the task after the last one of a packed range.
+inline int endOf(const std::uint64_t f_bounds) {
+  return static_cast<int>(f_bounds & _RANGE_MASK);
+}
+
+/************************************************************/
+ThreadPool::ThreadPool(const int f_nb_workers)
+    : nb_steals{0},
+      nb_workers{f_nb_workers > 0
+                     ? f_nb_workers
+                     : std::max(1, static_cast<int>(
+                                       std::thread::hardware_concurrency()))},
+      ranges{new Range[nb_workers]}, task{nullptr}, nb_pending{0}, epoch{0},
+      stop{false} {
+  for (int w = 0; w < nb_workers; ++w)
+    ranges[w].bounds = pack(0, 0, 0);
+  for (int w = 1; w < nb_workers; ++w)
+    threads.emplace_back(&ThreadPool::loop, this, w);
+}
+
+/************************************************************/
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  wake.notify_all();
+  for (std::thread &thread : threads)
+    thread.join();
+}
+
+/************************************************************/
+void ThreadPool::run(const int f_nb_tasks,
+                     const std::function<void(int, int)> &f_task) {
+  assert(static_cast<std::uint64_t>(f_nb_tasks) <= _RANGE_MASK);
+  if (nb_workers == 1) {
+    for (int t = 0; t < f_nb_tasks; ++t)
+      f_task(t, 0);
+    return;
+  }
+  if (f_nb_tasks <= 0)
+    return;
+
+  std::uint64_t run;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    run = ++epoch & 0xffff;
+    task = &f_task;
+    nb_pending = f_nb_tasks;
+    for (int w = 0; w < nb_workers; ++w) {
+      ranges[w].bounds = pack(run, static_cast<int>(
+                                       static_cast<long long>(f_nb_tasks) *
+                                       w / nb_workers),
+                              static_cast<int>(
+                                  static_cast<long long>(f_nb_tasks) *
+                                  (w + 1) / nb_workers));
+    }
+  }
+  wake.notify_all();
+
+  // The caller works too, then only waits for the tasks still running
+  work(0);
+  std::unique_lock<std::mutex> lock(mutex);
+  done.wait(lock, [this] { return nb_pending == 0; });
+}
+
+/************************************************************/
+void ThreadPool::loop(const int f_worker) {
+  std::uint64_t seen{0};
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      wake.wait(lock, [&] { return stop || epoch != seen; });
+      if (stop)
+        return;
+      seen = epoch;
+    }
+    work(f_worker);
+  }
+}
+
+/************************************************************/
+void ThreadPool::work(const int f_worker) {
+  int t;
+  while (take(f_worker, t)) {
+    (*task)(t, f_worker);
+    if (--nb_pending == 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      done.notify_all();
+    }
+  }
+}
+
+/************************************************************/
+bool ThreadPool::take(const int f_worker, int &f_task) {
+  // The front of the own range
+  std::atomic<std::uint64_t> &own{ranges[f_worker].bounds};
+  std::uint64_t bounds{own.load()};
+  const std::uint64_t run{runOf(bounds)};
+  while (beginOf(bounds) < endOf(bounds)) {
+    if (own.compare_exchange_weak(bounds,
+                                  bounds + (std::uint64_t{1} << _RANGE_BITS))) {
+      f_task = beginOf(bounds);
+      return true;
+    }
+  }
+
+  // Else the back half of the range of another worker, of the same run. The
+  // stolen tasks are not done yet: the own range cannot be reset meanwhile
+  for (int i = 1; i < nb_workers; ++i) {
+    std::atomic<std::uint64_t> &victim{
+        ranges[(f_worker + i) % nb_workers].bounds};
+    std::uint64_t stolen{victim.load()};
+    while (runOf(stolen) == run && beginOf(stolen) < endOf(stolen)) {
+      const int begin{beginOf(stolen)};
+      const int end{endOf(stolen)};
+      const int middle{end - (end - begin + 1) / 2};
+      if (victim.compare_exchange_weak(stolen, pack(run, begin, middle))) {
+        ++nb_steals;
+        own = pack(run, middle + 1, end);
+        f_task = middle;
+        return true;
+      }
+    }
+  }
+  return false;
+}
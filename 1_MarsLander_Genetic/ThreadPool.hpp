@@ -0,0 +1,99 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! @brief  Lightweight work-stealing pool of threads.
+//!
+//! `run` cuts the tasks in one contiguous range per worker. A worker takes
+//! its tasks from the front of its range; once empty, it steals the back half
+//! of the range of another worker. The calling thread is the worker 0: with a
+//! single worker, the tasks run in order on the caller, without any thread.
+//!
+//! A range packs its bounds and the number of the run in one atomic word, so
+//! that the owner and the thieves share it without lock, and a late thief
+//! cannot take a task of another run. The workers never wait for each other:
+//! `run` returns as soon as the last task is done, and the idle workers sleep
+//! until the next run.
+class ThreadPool {
+public:
+  //! @brief  C'tor. Starts the threads.
+  //!
+  //! @param[in] f_nb_workers  Number of workers, the caller included. 0 for
+  //!                          one per hardware thread.
+  explicit ThreadPool(const int f_nb_workers = 0);
+
+  //! @brief  D'tor. Stops and joins the threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  //! @brief  Get the number of workers, the caller included.
+  int size() const { return nb_workers; }
+
+  //! @brief  Run `f_task(task, worker)` for every task in [0, f_nb_tasks),
+  //!         and wait for the end of them all.
+  //!
+  //! The tasks of a worker run one after the other: a scratch per worker
+  //! needs no lock.
+  //!
+  //! @param[in] f_nb_tasks  Number of tasks.
+  //! @param[in] f_task      The task, given its index and its worker index.
+  void run(const int f_nb_tasks,
+           const std::function<void(int, int)> &f_task);
+
+  std::atomic<long long> nb_steals; //!< Ranges stolen since the c'tor.
+
+private:
+  //! @brief  Range of tasks of a worker, padded to a cache line.
+  //!
+  //! Not `alignas`: the C++14 `new` ignores it. The bounds of two workers
+  //! are a cache line apart, hence never on the same one, wherever the
+  //! array starts.
+  struct Range {
+    std::atomic<std::uint64_t> bounds; //!< Run, begin and end, packed.
+    char padding[64 - sizeof(std::atomic<std::uint64_t>)]; //!< To 64 bytes.
+  };
+
+  //! @brief  Loop of a thread: sleep, then work on each new run.
+  //!
+  //! @param[in] f_worker  Index of the worker.
+  void loop(const int f_worker);
+
+  //! @brief  Run tasks until none is left to take.
+  //!
+  //! @param[in] f_worker  Index of the worker.
+  void work(const int f_worker);
+
+  //! @brief  Take a task: the front of the own range, else a stolen one.
+  //!
+  //! @param[in]  f_worker  Index of the worker.
+  //! @param[out] f_task    The task.
+  //!
+  //! @return False if no task is left to take.
+  bool take(const int f_worker, int &f_task);
+
+  const int nb_workers; //!< Number of workers, the caller included.
+
+  std::unique_ptr<Range[]> ranges;  //!< Range of each worker.
+  std::vector<std::thread> threads; //!< Workers 1 to `nb_workers - 1`.
+
+  std::atomic<const std::function<void(int, int)> *> task; //!< Current task.
+  std::atomic<int> nb_pending; //!< Tasks of the run not done yet.
+
+  std::mutex mutex;             //!< Guards `epoch`, `stop` and the waits.
+  std::condition_variable wake; //!< Signals a new run, or the stop.
+  std::condition_variable done; //!< Signals the end of a run.
+  std::uint64_t epoch;          //!< Number of the current run.
+  bool stop;                    //!< Threads asked to stop.
+};
+
+#endif
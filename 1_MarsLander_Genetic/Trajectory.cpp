@@ -0,0 +1,249 @@
+// Standard libraries
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TRAJECTORY_AVX2
+#endif
+
+#include "Trajectory.hpp"
+
+extern const float _w; //!< Map width.
+extern const float _h; //!< Map height.
+
+//! @brief  In place inclusive scan: data[i] = init + data[0] + ... + data[i].
+//!
+//! @param[in,out] f_data  The values to scan.
+//! @param[in]     f_size  Number of values.
+//! @param[in]     f_init  Value to start the sums with.
+void inclusiveScan(double *f_data, const int f_size, const double f_init) {
+  int i{0};
+  double carry{f_init};
+#if defined(TRAJECTORY_AVX2)
+  const __m256d zero{_mm256_setzero_pd()};
+  __m256d carry_pd{_mm256_set1_pd(f_init)};
+  for (; i + 4 <= f_size; i += 4) {
+    __m256d v{_mm256_loadu_pd(&f_data[i])};
+    // [a, b, c, d] + [0, a, b, c]
+    v = _mm256_add_pd(
+        v, _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(2, 1, 0, 0)),
+                           zero, 0x1));
+    // [a, a+b, b+c, c+d] + [0, 0, a, a+b]
+    v = _mm256_add_pd(
+        v, _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(1, 0, 0, 0)),
+                           zero, 0x3));
+    v = _mm256_add_pd(v, carry_pd);
+    _mm256_storeu_pd(&f_data[i], v);
+    carry_pd = _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 3, 3, 3));
+  }
+  carry = _mm256_cvtsd_f64(carry_pd);
+#endif
+  for (; i < f_size; ++i) {
+    carry += f_data[i];
+    f_data[i] = carry;
+  }
+}
+
+/************************************************************/
+void Trajectory::getRocket(const int k, Rocket &f_rocket) const {
+  f_rocket.pX = x[std::max(0, k - 1)];
+  f_rocket.pY = y[std::max(0, k - 1)];
+  f_rocket.x = x[k];
+  f_rocket.y = y[k];
+  f_rocket.vx = vx[k];
+  f_rocket.vy = vy[k];
+  f_rocket.ax = ax[k];
+  f_rocket.ay = ay[k];
+  f_rocket.angle = angle[k];
+  f_rocket.thrust = thrust[k];
+  f_rocket.fuel = fuel[k];
+}
+
+/************************************************************/
+void Trajectory::resize(const int f_size) {
+  size = f_size;
+  if (static_cast<int>(x.size()) > size)
+    return;
+
+  for (std::vector<double> *values : {&x, &y, &vx, &vy, &ax, &ay})
+    values->resize(size + 1);
+  angle.resize(size + 1);
+  thrust.resize(size + 1);
+  fuel.resize(size + 1);
+}
+
+/************************************************************/
+template <class Physics>
+void StepEngine::simulate(const Rocket &f_rocket,
+                          const Chromosome &f_chromosome, const int f_idxStart,
+                          Trajectory &f_trajectory) {
+  Rocket rocket{f_rocket};
+  const int size{f_chromosome.size()};
+  f_trajectory.resize(size);
+
+  // Around the ring, from the slot of the first gene
+  int slot{f_idxStart % size};
+  for (int k = 0; k <= f_trajectory.size; ++k) {
+    if (k > 0) {
+      const Gene &gene{f_chromosome.chromosome[slot]};
+      rocket.updateRocket<Physics>(gene.angle, gene.thrust);
+      if (++slot == size)
+        slot = 0;
+    }
+    f_trajectory.x[k] = rocket.x;
+    f_trajectory.y[k] = rocket.y;
+    f_trajectory.vx[k] = rocket.vx;
+    f_trajectory.vy[k] = rocket.vy;
+    f_trajectory.ax[k] = rocket.ax;
+    f_trajectory.ay[k] = rocket.ay;
+    f_trajectory.angle[k] = rocket.angle;
+    f_trajectory.thrust[k] = rocket.thrust;
+    f_trajectory.fuel[k] = rocket.fuel;
+  }
+}
+
+template void StepEngine::simulate<TrigPhysics>(const Rocket &,
+                                                const Chromosome &, const int,
+                                                Trajectory &);
+template void StepEngine::simulate<TablePhysics>(const Rocket &,
+                                                 const Chromosome &, const int,
+                                                 Trajectory &);
+
+/************************************************************/
+template <class Physics>
+void ScanEngine::simulate(const Rocket &f_rocket,
+                          const Chromosome &f_chromosome, const int f_idxStart,
+                          Trajectory &f_trajectory) {
+  Trajectory &t{f_trajectory};
+  const int n{f_chromosome.size()};
+  t.resize(n);
+
+  t.x[0] = f_rocket.x;
+  t.y[0] = f_rocket.y;
+  t.vx[0] = f_rocket.vx;
+  t.vy[0] = f_rocket.vy;
+  t.ax[0] = f_rocket.ax;
+  t.ay[0] = f_rocket.ay;
+  t.angle[0] = f_rocket.angle;
+  t.thrust[0] = f_rocket.thrust;
+  t.fuel[0] = f_rocket.fuel;
+
+  // Acceleration sequence: only depends on the clamped requests and the fuel
+  int angle{f_rocket.angle};
+  int thrust{f_rocket.thrust};
+  int fuel{f_rocket.fuel};
+  int slot{f_idxStart % n};
+  for (int k = 1; k <= n; ++k) {
+    const Gene &gene{f_chromosome.chromosome[slot]};
+    if (++slot == n)
+      slot = 0;
+    angle = std::min(90, std::max(-90, angle + gene.angle));
+    thrust = fuel == 0 ? 0 : std::min(4, std::max(0, thrust + gene.thrust));
+    fuel = std::max(0, fuel - thrust);
+
+    t.angle[k] = static_cast<std::int8_t>(angle);
+    t.thrust[k] = static_cast<std::int8_t>(thrust);
+    t.fuel[k] = fuel;
+    Physics::acceleration(angle, thrust, t.ax[k], t.ay[k]);
+  }
+
+  // v[k] = v[0] + acc[1] + ... + acc[k]
+  std::copy(t.ax.data() + 1, t.ax.data() + n + 1, t.vx.data() + 1);
+  std::copy(t.ay.data() + 1, t.ay.data() + n + 1, t.vy.data() + 1);
+  inclusiveScan(t.vx.data() + 1, n, t.vx[0]);
+  inclusiveScan(t.vy.data() + 1, n, t.vy[0]);
+
+  // p[k] = p[0] + sum of (0.5 * acc[j] + v[j - 1]), for j in [1, k]
+  for (int k = 1; k <= n; ++k) {
+    t.x[k] = 0.5 * t.ax[k] + t.vx[k - 1];
+    t.y[k] = 0.5 * t.ay[k] + t.vy[k - 1];
+  }
+  inclusiveScan(t.x.data() + 1, n, t.x[0]);
+  inclusiveScan(t.y.data() + 1, n, t.y[0]);
+
+  // The altitude is clamped at 0: from the first clamp, back to the serial
+  // recurrence
+  for (int k = 1; k <= n; ++k) {
+    if (t.y[k] < 0.) {
+      t.y[k] = 0.;
+      for (++k; k <= n; ++k) {
+        t.y[k] = std::max(0., t.y[k - 1] + (0.5 * t.ay[k] + t.vy[k - 1]));
+      }
+    }
+  }
+}
+
+template void ScanEngine::simulate<TrigPhysics>(const Rocket &,
+                                                const Chromosome &, const int,
+                                                Trajectory &);
+template void ScanEngine::simulate<TablePhysics>(const Rocket &,
+                                                 const Chromosome &, const int,
+                                                 Trajectory &);
+
+//! @brief  Check the collision of the k-th step of a trajectory.
+//!
+//! @param[in]  t              The trajectory.
+//! @param[in]  f_floor_index  The floor of the level.
+//! @param[in]  k              The step.
+//! @param[out] f_counters     Step counters of the floor index, nullptr for
+//!                            none.
+//!
+//! @return The collision, with a step of -1 if none.
+Collision checkStep(const Trajectory &t, const FloorIndex &f_floor_index,
+                    const int k, FloorCounters *f_counters) {
+  if (t.x[k] < 0 || t.x[k] > _w || t.y[k] < 0 || t.y[k] > _h)
+    return {k, -1};
+
+  const int floor_id{f_floor_index.firstIntersection(
+      {{t.x[k - 1], t.y[k - 1]}, {t.x[k], t.y[k]}}, f_counters)};
+  return {floor_id == -1 ? -1 : k, floor_id};
+}
+
+/************************************************************/
+Collision stepCollision(const Trajectory &f_trajectory,
+                        const FloorIndex &f_floor_index) {
+  for (int k = 1; k <= f_trajectory.size; ++k) {
+    const Collision collision{
+        checkStep(f_trajectory, f_floor_index, k, nullptr)};
+    if (collision.step != -1)
+      return collision;
+  }
+  return {-1, -1};
+}
+
+/************************************************************/
+template <int K>
+Collision sweptCollision(const Trajectory &f_trajectory,
+                         const FloorIndex &f_floor_index,
+                         long long &f_nbSteps, FloorCounters *f_counters) {
+  const Trajectory &t{f_trajectory};
+  for (int k0 = 0; k0 < t.size; k0 += K) {
+    const int k1{std::min(t.size, k0 + K)};
+
+    // Bounding box of the positions k0 to k1: holds the steps k0 + 1 to k1
+    double min_x{t.x[k0]}, max_x{t.x[k0]};
+    double min_y{t.y[k0]}, max_y{t.y[k0]};
+    for (int k = k0 + 1; k <= k1; ++k) {
+      min_x = std::min(min_x, t.x[k]);
+      max_x = std::max(max_x, t.x[k]);
+      min_y = std::min(min_y, t.y[k]);
+      max_y = std::max(max_y, t.y[k]);
+    }
+    if (min_x >= 0 && max_x <= _w && min_y >= 0 && max_y <= _h &&
+        !f_floor_index.mayTouch(min_x, max_x, min_y, max_y))
+      continue;
+
+    for (int k = k0 + 1; k <= k1; ++k) {
+      ++f_nbSteps;
+      const Collision collision{checkStep(t, f_floor_index, k, f_counters)};
+      if (collision.step != -1)
+        return collision;
+    }
+  }
+  return {-1, -1};
+}
+
+template Collision sweptCollision<8>(const Trajectory &, const FloorIndex &,
+                                     long long &, FloorCounters *);
+template Collision sweptCollision<16>(const Trajectory &, const FloorIndex &,
+                                      long long &, FloorCounters *);
@@ -0,0 +1,121 @@
+#ifndef TRAJECTORY_HPP
+#define TRAJECTORY_HPP
+
+#include <vector>
+
+#include "FloorIndex.hpp"
+#include "Genetic.hpp"
+#include "Rocket.hpp"
+
+//! Maximum absolute difference, in m or m/s, between the positions and speeds
+//! of `ScanEngine` and `StepEngine` over a whole chromosome.
+constexpr double _SCAN_TOLERANCE{1e-9};
+
+constexpr int _SWEPT_BLOCK{8}; //!< Steps per block of `sweptCollision`.
+
+//! @brief  Trajectory of a rocket following a chromosome.
+//!
+//! The index 0 holds the initial state, the index k the state after the k-th
+//! step, i.e., after the gene `idxStart + k - 1`. The arrays hold `size + 1`
+//! values; they only grow, so that a trajectory reused chromosome after
+//! chromosome allocates once.
+struct Trajectory {
+  std::vector<double> x;  //!< X coordinates.
+  std::vector<double> y;  //!< Y coordinates.
+  std::vector<double> vx; //!< Horizontal velocities.
+  std::vector<double> vy; //!< Vertical velocities.
+  std::vector<double> ax; //!< Horizontal accelerations.
+  std::vector<double> ay; //!< Vertical accelerations.
+
+  std::vector<std::int8_t> angle;  //!< Angles.
+  std::vector<std::int8_t> thrust; //!< Thrust powers.
+  std::vector<int> fuel;           //!< Remaining fuels.
+
+  int size{0}; //!< Number of steps.
+
+  //! @brief  Set the number of steps, growing the arrays if needed.
+  //!
+  //! @param[in] f_size  The number of steps.
+  void resize(const int f_size);
+
+  //! @brief  Get the rocket after the k-th step.
+  //!
+  //! @param[in]  k         The step.
+  //! @param[out] f_rocket  The rocket to fill. Its previous coordinates are
+  //!                       the ones of the step k - 1.
+  void getRocket(const int k, Rocket &f_rocket) const;
+};
+
+//! @brief  Scalar step loop: `Rocket::updateRocket` gene after gene.
+struct StepEngine {
+  //! @brief  Simulate the rocket following the chromosome, from `f_idxStart`
+  //!         to the end of its horizon: once around its ring of genes.
+  //!         Collisions are not checked.
+  //!
+  //! @tparam Physics  Policy giving the accelerations: `TrigPhysics` or
+  //!                  `TablePhysics`.
+  //!
+  //! @param[in]  f_rocket      The initial rocket.
+  //! @param[in]  f_chromosome  The chromosome to follow.
+  //! @param[in]  f_idxStart    Index of the first gene to apply.
+  //! @param[out] f_trajectory  The resulting trajectory.
+  template <class Physics = DefaultPhysics>
+  static void simulate(const Rocket &f_rocket, const Chromosome &f_chromosome,
+                       const int f_idxStart, Trajectory &f_trajectory);
+};
+
+//! @brief  Closed-form evaluation of the trajectory.
+//!
+//! With t = 1, the speeds are the prefix sums of the accelerations, and the
+//! positions the prefix sums of `0.5 * acc + previous speed`. The
+//! accelerations only depend on the clamped angle, thrust power and fuel
+//! sequences, computed first; the speeds and positions are then obtained with
+//! vectorized inclusive scans instead of the serial dependency chain.
+//! The summation order differs from `StepEngine`: results are equal within
+//! `_SCAN_TOLERANCE`.
+struct ScanEngine {
+  //! @brief  Same as `StepEngine::simulate`.
+  template <class Physics = DefaultPhysics>
+  static void simulate(const Rocket &f_rocket, const Chromosome &f_chromosome,
+                       const int f_idxStart, Trajectory &f_trajectory);
+};
+
+//! @brief  First collision of a trajectory: out of the map, or on the floor.
+struct Collision {
+  int step;    //!< The step of the collision, -1 if none.
+  int floorId; //!< ID of the floor segment crossed, -1 if out of the map.
+};
+
+//! @brief  Check the collisions of a trajectory step after step, as `solve`
+//!         does.
+//!
+//! @param[in] f_trajectory   The trajectory.
+//! @param[in] f_floor_index  The floor of the level.
+//!
+//! @return The first collision.
+Collision stepCollision(const Trajectory &f_trajectory,
+                        const FloorIndex &f_floor_index);
+
+//! @brief  Same as `stepCollision`, block of K steps after block.
+//!
+//! The bounding box of the positions of a block holds all its steps. If it
+//! lies within the map and touches no floor segment, see
+//! `FloorIndex::mayTouch`, the whole block is skipped. Else its steps are
+//! checked one by one. High in the sky, a single test replaces K.
+//!
+//! @tparam K  Number of steps per block.
+//!
+//! @param[in]  f_trajectory   The trajectory.
+//! @param[in]  f_floor_index  The floor of the level.
+//! @param[out] f_nbSteps      Number of steps checked one by one.
+//! @param[out] f_counters     Step counters of the floor index. Default is
+//!                            nullptr, none.
+//!
+//! @return The first collision, the same as `stepCollision`.
+template <int K = _SWEPT_BLOCK>
+Collision sweptCollision(const Trajectory &f_trajectory,
+                         const FloorIndex &f_floor_index,
+                         long long &f_nbSteps,
+                         FloorCounters *f_counters = nullptr);
+
+#endif
@@ -93,21 +93,22 @@ int Visualization_OpenGL::initOpenGL(const bool doIt) {
 }
 
 /************************************************************/
-void Visualization_OpenGL::set(const Rocket &f_rocket, const int *const level,
-                               const int size_level, const bool doIt) {
-  m_level = level;
-  m_size_level = size_level;
+void Visualization_OpenGL::set(const Rocket &f_rocket,
+                               const LevelGeometry &f_geometry,
+                               const GeneticConfig &f_config,
+                               const bool doIt) {
+  m_geometry = &f_geometry;
+  m_size_level = f_geometry.size_floor;
+  m_population_size = f_config.population_size;
+  m_chromosome_size = f_config.chromosome_size;
+  m_size_buffer_chromosome = 3 * 2 * m_chromosome_size;
   m_doIt = doIt;
 
   if (!m_doIt)
       return;
 
-  for (int chrom = 0; chrom < _POPULATION_SIZE; ++chrom) {
-    rockets_line[chrom * _SIZE_BUFFER_CHROMOSOME + 0] =
-        2.f * static_cast<GLfloat>(f_rocket.x) / _w - 1;
-    rockets_line[chrom * _SIZE_BUFFER_CHROMOSOME + 1] =
-        2.f * static_cast<GLfloat>(f_rocket.y) / _h - 1;
-  }
+  rockets_line.assign(m_population_size * m_size_buffer_chromosome, 0.f);
+  startRocketLines(f_rocket);
 
   for (int i = 0; i < 9; ++i)
     GL_rocket_buffer_data[i] = 0.;
@@ -116,25 +117,15 @@ void Visualization_OpenGL::set(const Rocket &f_rocket, const int *const level,
 
   // Convert from [0, _w] x [0, _h] to [-1, 1] x [-1, 1]
   GLfloat floor_buffer_data[3 * (2 * (_MAX_SIZE_FLOOR - 1))];
-  for (int i = 0; i < m_size_level; ++i) {
-    if (i == 0) {
-      floor_buffer_data[0] = 2 * m_level[0] / _w - 1;
-      floor_buffer_data[1] = 2 * m_level[1] / _h - 1;
-      floor_buffer_data[2] = 0.f;
-    } else if (i == m_size_level - 1) {
-      const int idx{3 * (2 * m_size_level - 3)};
-      floor_buffer_data[idx + 0] = 2 * m_level[2 * i + 0] / _w - 1;
-      floor_buffer_data[idx + 1] = 2 * m_level[2 * i + 1] / _h - 1;
-      floor_buffer_data[idx + 2] = 0.f;
-    } else {
-      const int idx{3 * (2 * i - 1)};
-      floor_buffer_data[idx + 0] = 2 * m_level[2 * i + 0] / _w - 1;
-      floor_buffer_data[idx + 1] = 2 * m_level[2 * i + 1] / _h - 1;
-      floor_buffer_data[idx + 2] = 0.f;
-      floor_buffer_data[idx + 3] = 2 * m_level[2 * i + 0] / _w - 1;
-      floor_buffer_data[idx + 4] = 2 * m_level[2 * i + 1] / _h - 1;
-      floor_buffer_data[idx + 5] = 0.f;
-    }
+  for (int k = 1; k < m_size_level; ++k) {
+    const Line_d &segment{m_geometry->segments[k]};
+    const int idx{3 * 2 * (k - 1)};
+    floor_buffer_data[idx + 0] = 2 * segment.p1.x / _w - 1;
+    floor_buffer_data[idx + 1] = 2 * segment.p1.y / _h - 1;
+    floor_buffer_data[idx + 2] = 0.f;
+    floor_buffer_data[idx + 3] = 2 * segment.p2.x / _w - 1;
+    floor_buffer_data[idx + 4] = 2 * segment.p2.y / _h - 1;
+    floor_buffer_data[idx + 5] = 0.f;
   }
 
   glGenBuffers(1, &floorbuffer);
@@ -146,31 +137,62 @@ void Visualization_OpenGL::set(const Rocket &f_rocket, const int *const level,
 /************************************************************/
 GLFWwindow *Visualization_OpenGL::getWindow() { return m_window; }
 
+/************************************************************/
+void Visualization_OpenGL::startRocketLines(const Rocket &f_rocket) {
+  if (!m_doIt)
+    return;
+
+  for (int chrom = 0; chrom < m_population_size; ++chrom) {
+    rockets_line[chrom * m_size_buffer_chromosome + 0] =
+        2.f * static_cast<GLfloat>(f_rocket.x) / _w - 1;
+    rockets_line[chrom * m_size_buffer_chromosome + 1] =
+        2.f * static_cast<GLfloat>(f_rocket.y) / _h - 1;
+  }
+}
+
 /************************************************************/
 void Visualization_OpenGL::updateRocketLine(const Rocket *f_rocket,
                                             const int f_gen,
                                             const int f_chrom) {
+  updateRocketLine(f_rocket->x, f_rocket->y, f_gen, f_chrom);
+}
+
+/************************************************************/
+void Visualization_OpenGL::updateRocketLine(const double f_x, const double f_y,
+                                            const int f_gen,
+                                            const int f_chrom) {
   if (!m_doIt)
     return;
 
   const int idx{3 * (2 * f_gen + 1)};
 
-  rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 0] =
-      static_cast<GLfloat>(2.f * f_rocket->x / _w - 1);
+  rockets_line[f_chrom * m_size_buffer_chromosome + idx + 0] =
+      static_cast<GLfloat>(2.f * f_x / _w - 1);
+
+  rockets_line[f_chrom * m_size_buffer_chromosome + idx + 1] =
+      static_cast<GLfloat>(2.f * f_y / _h - 1);
 
-  rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 1] =
-      static_cast<GLfloat>(2.f * f_rocket->y / _h - 1);
+  rockets_line[f_chrom * m_size_buffer_chromosome + idx + 2] = 0.f;
 
-  rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 2] = 0.f;
+  if (f_gen != m_chromosome_size - 1) {
+    rockets_line[f_chrom * m_size_buffer_chromosome + idx + 3] =
+        rockets_line[f_chrom * m_size_buffer_chromosome + idx + 0];
 
-  if (f_gen != _CHROMOSOME_SIZE - 1) {
-    rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 3] =
-        rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 0];
+    rockets_line[f_chrom * m_size_buffer_chromosome + idx + 4] =
+        rockets_line[f_chrom * m_size_buffer_chromosome + idx + 1];
 
-    rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 4] =
-        rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 1];
+    rockets_line[f_chrom * m_size_buffer_chromosome + idx + 5] = 0.f;
+  }
+}
+
+/************************************************************/
+void Visualization_OpenGL::fillRocketLine(const double f_x, const double f_y,
+                                          const int f_gen, const int f_chrom) {
+  if (!m_doIt)
+    return;
 
-    rockets_line[f_chrom * _SIZE_BUFFER_CHROMOSOME + idx + 5] = 0.f;
+  for (int gen = f_gen; gen < m_chromosome_size; ++gen) {
+    updateRocketLine(f_x, f_y, gen, f_chrom);
   }
 }
 
@@ -257,15 +279,16 @@ void Visualization_OpenGL::drawPopulation() {
   glDrawArrays(GL_LINES, 0, m_size_level * 2);
   glDisableVertexAttribArray(0);
 
-  for (int pop = 0; pop < _POPULATION_SIZE; pop++) {
+  for (int pop = 0; pop < m_population_size; pop++) {
     glUseProgram(programIDLine);
 
     GLuint rocketbuffer;
     glGenBuffers(1, &rocketbuffer);
     glBindBuffer(GL_ARRAY_BUFFER, rocketbuffer);
     glBufferData(GL_ARRAY_BUFFER,
-                 _SIZE_BUFFER_CHROMOSOME * sizeof(rockets_line[0]),
-                 rockets_line + pop * _SIZE_BUFFER_CHROMOSOME, GL_STATIC_DRAW);
+                 m_size_buffer_chromosome * sizeof(rockets_line[0]),
+                 rockets_line.data() + pop * m_size_buffer_chromosome,
+                 GL_STATIC_DRAW);
 
     glEnableVertexAttribArray(4);
     glBindBuffer(GL_ARRAY_BUFFER, rocketbuffer);
@@ -279,7 +302,7 @@ void Visualization_OpenGL::drawPopulation() {
     );
 
     // Draw the rocket lines
-    glDrawArrays(GL_LINES, 0, _CHROMOSOME_SIZE * 2);
+    glDrawArrays(GL_LINES, 0, m_chromosome_size * 2);
     glDeleteBuffers(1, &rocketbuffer);
   }
 
@@ -14,13 +14,14 @@
 #include <glm/gtx/quaternion.hpp>
 using namespace glm;
 
-#include "Genetic.hpp"
+#include <vector>
 
-//!< Size if of the buffer containing the genes of a chromosome.
-constexpr size_t _SIZE_BUFFER_CHROMOSOME{3 * 2 * _CHROMOSOME_SIZE};
+#include "Evaluator.hpp"
+#include "Genetic.hpp"
+#include "LevelGeometry.hpp"
 
 //! brief  Visualization class
-class Visualization_OpenGL {
+class Visualization_OpenGL : public RocketLines {
 public:
   //! @brief  Get the singleton instance.
   //!
@@ -44,22 +45,51 @@ public:
   //! @return 0 on success, -1 on failure.
   int initOpenGL(const bool doIt);
 
-  void set(const Rocket &f_rocket, const int *const level, const int size_level,
-           const bool doIt);
+  //! @brief  Prepare the buffers of a level.
+  //!
+  //! @param[in] f_rocket    The initial rocket.
+  //! @param[in] f_geometry  Geometry of the level.
+  //! @param[in] f_config    Dimensions of the population to draw.
+  //! @param[in] doIt        Whether or not to do the visualization.
+  void set(const Rocket &f_rocket, const LevelGeometry &f_geometry,
+           const GeneticConfig &f_config, const bool doIt);
 
   //! @brief  Get a pointer to the opaque windows object.
   //!
   //! @return A pointer to the opaque windows object.
   GLFWwindow *getWindow();
 
+  //! @brief  Start the OpenGL line of every rocket at a rocket: the first one
+  //!         of the horizon.
+  //!
+  //! @param[in] f_rocket  The rocket.
+  void startRocketLines(const Rocket &f_rocket);
+
   //! @brief  Update the OpenGL line of one rocket among the whole population.
   //!
   //! @param[in] f_rocket  A current rocket state.
-  //! @param[in] f_gen     Its gene index within its chromosome.
+  //! @param[in] f_gen     Its gene index within the horizon.
   //! @param[in] f_chrom   Its chromosome index within the population.
   void updateRocketLine(const Rocket *f_rocket, const int f_gen,
                         const int f_chrom);
 
+  //! @brief  Update the OpenGL line of one rocket among the whole population.
+  //!
+  //! @param[in] f_x, f_y  The current rocket coordinates.
+  //! @param[in] f_gen     Its gene index within the horizon.
+  //! @param[in] f_chrom   Its chromosome index within the population.
+  void updateRocketLine(const double f_x, const double f_y, const int f_gen,
+                        const int f_chrom) override;
+
+  //! @brief  Fill the OpenGL line of one dead rocket, from its death to the
+  //!         end of its chromosome, with its last coordinates.
+  //!
+  //! @param[in] f_x, f_y  The last rocket coordinates.
+  //! @param[in] f_gen     The gene index of its death within the horizon.
+  //! @param[in] f_chrom   Its chromosome index within the population.
+  void fillRocketLine(const double f_x, const double f_y, const int f_gen,
+                      const int f_chrom) override;
+
   //! @brief  Update the OpenGL buffers for the single rocket.
   //!
   //! @param[in] f_rocket   The rocket.
@@ -89,14 +119,16 @@ private:
   GLuint programIDRocket; //!< Green rocket program.
   GLuint floorbuffer;     //!< Buffer containing the floor data.
 
-  GLfloat rockets_line[_POPULATION_SIZE *
-                       _SIZE_BUFFER_CHROMOSOME]; //!< The population buffer.
+  std::vector<GLfloat> rockets_line; //!< The population buffer.
+  int m_population_size;             //!< Amount of chromosome drawn.
+  int m_chromosome_size;             //!< Amount of gene per chromosome.
+  int m_size_buffer_chromosome;      //!< Size of the buffer of a chromosome.
 
   GLfloat GL_rocket_buffer_data[9]; //!< Single rocket triangle buffer.
   GLfloat GL_fire_buffer_data[6];   //!< Single rocket thrust power buffer.
 
-  const int *m_level; //!< Poiter to the current floor data buffer.
-  int m_size_level;   //!< Size of the current floor data buffer.
+  const LevelGeometry *m_geometry; //!< Geometry of the current level.
+  int m_size_level;                //!< Number of points of the floor.
 
   bool m_doIt;     //!< Whether or not to do the visualization.
   bool m_initDone; //!< Whether or not the initialization is done.